@@ -0,0 +1,425 @@
+/*
+ * Microbenchmarks of the BufferPacker hot path against hand-written baselines.
+ *
+ * Build and run from the repository root (or: pio run -e bench && .pio/build/bench/program):
+ *   g++ -std=gnu++20 -O2 -Iinclude bench/BufferPackerBench.cpp -o bufferpacker_bench
+ *   ./bufferpacker_bench [--json] [--filter=SUBSTRING] [--min-time-ms=N]
+ *
+ * Every case reports nanoseconds per operation (the median and the fastest of several repetitions) and, where it
+ * has one, the ratio to its baseline: the same work written directly with memcpy or with std::bit_cast. The library
+ * itself only needs C++17, but the benchmark builds as C++20 for std::bit_cast; a build without it names that row
+ * memcpy_cast_unpack instead. Ratios are what to watch for regressions, since they hold across machines; absolute
+ * times only compare runs on the same machine.
+ *
+ * Output is CSV by default, one row per case, or a JSON array with --json. --filter keeps the cases whose name or
+ * group contains SUBSTRING, together with the baselines they are compared against.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+#include "BufferPacker.h"
+
+/** A 16-byte record, standing in for the struct wrappers arrays are packed through. */
+struct BenchRecord
+{
+    uint32_t id;
+    uint32_t timestamp;
+    uint8_t data[8];
+};
+
+template <typename T> struct TypeName;
+template <> struct TypeName<uint8_t> { static constexpr const char* value = "uint8_t"; };
+template <> struct TypeName<uint16_t> { static constexpr const char* value = "uint16_t"; };
+template <> struct TypeName<uint32_t> { static constexpr const char* value = "uint32_t"; };
+template <> struct TypeName<uint64_t> { static constexpr const char* value = "uint64_t"; };
+template <> struct TypeName<float> { static constexpr const char* value = "float"; };
+template <> struct TypeName<double> { static constexpr const char* value = "double"; };
+template <> struct TypeName<BenchRecord> { static constexpr const char* value = "BenchRecord"; };
+
+/** Keep the compiler from discarding a value it can prove is unused. */
+template <typename T> inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/** Keep the compiler from assuming memory is unchanged across this point. */
+inline void clobberMemory()
+{
+    asm volatile("" : : : "memory");
+}
+
+/** Name of the row that loads values with bitCast(), after what bitCast() really is in this build. */
+#if defined(__cpp_lib_bit_cast)
+constexpr const char* BIT_CAST_NAME = "bit_cast_unpack";
+#else
+constexpr const char* BIT_CAST_NAME = "memcpy_cast_unpack";
+#endif
+
+/** Reinterpret the bytes of a trivially copyable value as another type of the same size. */
+template <typename TO, typename FROM> inline TO bitCast(const FROM& from)
+{
+#if defined(__cpp_lib_bit_cast)
+    return std::bit_cast<TO>(from);
+#else
+    TO to;
+    memcpy(&to, &from, sizeof(TO));
+    return to;
+#endif
+}
+
+/** Bytes of a T, so a baseline can load them with bitCast(). */
+template <typename T> struct BenchBytes
+{
+    uint8_t bytes[sizeof(T)];
+};
+
+struct BenchResult
+{
+    std::string name;
+    std::string group;
+    std::string type;
+    size_t size;
+    double medianNs;
+    double minNs;
+    /** Index of the baseline result in the list; -1 if the case is a baseline itself. */
+    long baseline;
+};
+
+struct BenchOptions
+{
+    bool json = false;
+    std::string filter;
+    double minTimeMs = 20;
+    int repetitions = 7;
+};
+
+static BenchOptions g_Options;
+static std::vector<BenchResult> g_Results;
+
+/** @return true if the filter keeps a case with one of these names, or a case in this group */
+static bool selected(const std::initializer_list<std::string> names, const std::string& group)
+{
+    if (g_Options.filter.empty() || group.find(g_Options.filter) != std::string::npos)
+    {
+        return true;
+    }
+    for (const std::string& name : names)
+    {
+        if (name.find(g_Options.filter) != std::string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Time body, which does opsPerCall operations per call, and record the result, unless the filter drops the case.
+ *
+ * A baseline is measured whenever a case that refers to it is kept, so its ratio is never lost to the filter;
+ * required says so.
+ *
+ * @return the index of the result, for cases that use it as their baseline; -1 if the case was filtered out
+ */
+template <typename BODY>
+static long measure(const std::string& name, const std::string& group, const char* type, const size_t size,
+                    const size_t opsPerCall, const long baseline, const bool required, BODY&& body)
+{
+    if (!required && !selected({name}, group))
+    {
+        return -1;
+    }
+    using Clock = std::chrono::steady_clock;
+
+    // Grow the iteration count until one repetition takes the minimum time
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        const auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            body();
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (ms >= g_Options.minTimeMs || iterations >= (1ull << 40))
+        {
+            break;
+        }
+        iterations = ms <= 0.01 ? iterations * 100
+                                : static_cast<uint64_t>(iterations * g_Options.minTimeMs / ms * 1.2) + 1;
+    }
+
+    std::vector<double> samples;
+    for (int repetition = 0; repetition < g_Options.repetitions; repetition++)
+    {
+        const auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            body();
+        }
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(ns / static_cast<double>(iterations * opsPerCall));
+    }
+    std::sort(samples.begin(), samples.end());
+    g_Results.push_back({name, group, type, size, samples[samples.size() / 2], samples[0], baseline});
+    return static_cast<long>(g_Results.size() - 1);
+}
+
+/** Values to pack, produced at run time so they can't be folded into constants. */
+template <typename T, size_t COUNT> static void fillValues(T (&values)[COUNT])
+{
+    const unsigned seed = static_cast<unsigned>(std::rand());
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        uint8_t bytes[sizeof(T)];
+        for (size_t b = 0; b < sizeof(T); b++)
+        {
+            bytes[b] = static_cast<uint8_t>(seed + i * 31 + b * 7);
+        }
+        memcpy(&values[i], bytes, sizeof(T));
+    }
+}
+
+/** pack, unpack, skip and seek of one type into a buffer of SIZE bytes, filled completely. */
+template <typename T, size_t SIZE> static void benchType()
+{
+    constexpr size_t COUNT = SIZE / sizeof(T);
+    if constexpr (COUNT > 0)
+    {
+        const char* type = TypeName<T>::value;
+        const std::string suffix = std::string("<") + type + ", " + std::to_string(SIZE) + ">";
+        T values[COUNT];
+        fillValues(values);
+        uint8_t source[SIZE];
+        memcpy(source, values, COUNT * sizeof(T));
+
+        // pack
+        const long packBaseline = measure("memcpy_pack" + suffix, "pack", type, SIZE, COUNT, -1,
+            selected({"pack" + suffix}, "pack"), [&] {
+            uint8_t buffer[SIZE];
+            size_t offset = 0;
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                memcpy(&buffer[offset], &values[i], sizeof(T));
+                offset += sizeof(T);
+            }
+            doNotOptimize(buffer);
+        });
+        measure("pack" + suffix, "pack", type, SIZE, COUNT, packBaseline, false, [&] {
+            BufferPacker<SIZE> packer;
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                packer.pack(values[i]);
+            }
+            doNotOptimize(packer);
+        });
+
+        // unpack
+        const long unpackBaseline = measure("memcpy_unpack" + suffix, "unpack", type, SIZE, COUNT, -1,
+            selected({BIT_CAST_NAME + suffix, "unpack" + suffix, "skip" + suffix, "seek" + suffix}, "unpack"), [&] {
+            clobberMemory();
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                T value;
+                memcpy(&value, &source[i * sizeof(T)], sizeof(T));
+                doNotOptimize(value);
+            }
+        });
+        measure(BIT_CAST_NAME + suffix, "unpack", type, SIZE, COUNT, unpackBaseline, false, [&] {
+            clobberMemory();
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                BenchBytes<T> bytes;
+                memcpy(bytes.bytes, &source[i * sizeof(T)], sizeof(T));
+                doNotOptimize(bitCast<T>(bytes));
+            }
+        });
+        measure("unpack" + suffix, "unpack", type, SIZE, COUNT, unpackBaseline, false, [&] {
+            BufferPacker<SIZE> unpacker(source);
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                doNotOptimize(unpacker.template unpack<T>());
+            }
+        });
+
+        // skip and seek, which move or read without the other half of unpack()
+        measure("skip" + suffix, "unpack", type, SIZE, COUNT, unpackBaseline, false, [&] {
+            BufferPacker<SIZE> unpacker(source);
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                unpacker.template skip<T>();
+            }
+            doNotOptimize(unpacker);
+        });
+        measure("seek" + suffix, "unpack", type, SIZE, COUNT, unpackBaseline, false, [&] {
+            BufferPacker<SIZE> unpacker(source);
+            for (size_t i = 0; i < COUNT; i++)
+            {
+                doNotOptimize(unpacker.template seek<T>());
+            }
+        });
+    }
+}
+
+/** Whole-buffer operations for a buffer of SIZE bytes. */
+template <size_t SIZE> static void benchSize()
+{
+    const std::string suffix = "<" + std::to_string(SIZE) + ">";
+    uint8_t source[SIZE];
+    fillValues(source);
+
+    const long copyBaseline = measure("memcpy" + suffix, "copy", "uint8_t", SIZE, 1, -1,
+        selected({"array_constructor" + suffix, "pointer_constructor" + suffix, "deepCopyTo" + suffix,
+                  "getOwnedHeapBuffer" + suffix}, "copy") || selected({"reset_src" + suffix}, "reset"), [&] {
+        uint8_t buffer[SIZE];
+        clobberMemory();
+        memcpy(buffer, source, SIZE);
+        doNotOptimize(buffer);
+    });
+
+    // Constructors
+    measure("array_constructor" + suffix, "copy", "uint8_t", SIZE, 1, copyBaseline, false, [&] {
+        clobberMemory();
+        BufferPacker<SIZE> unpacker(source);
+        doNotOptimize(unpacker);
+    });
+    measure("pointer_constructor" + suffix, "copy", "uint8_t", SIZE, 1, copyBaseline, false, [&] {
+        clobberMemory();
+        BufferPacker<SIZE> unpacker(static_cast<const uint8_t*>(source), SIZE);
+        doNotOptimize(unpacker);
+    });
+
+    // deepCopyTo copies the packed bytes out of a full packer
+    BufferPacker<SIZE> full;
+    for (size_t i = 0; i < SIZE; i++)
+    {
+        full.pack(source[i]);
+    }
+    measure("deepCopyTo" + suffix, "copy", "uint8_t", SIZE, 1, copyBaseline, false, [&] {
+        uint8_t dest[SIZE];
+        clobberMemory();
+        full.deepCopyTo(dest);
+        doNotOptimize(dest);
+    });
+
+    measure("getOwnedHeapBuffer" + suffix, "copy", "uint8_t", SIZE, 1, copyBaseline, false, [&] {
+        const uint8_t* heapBuffer = full.getOwnedHeapBuffer();
+        doNotOptimize(heapBuffer);
+        delete[] heapBuffer;
+    });
+
+    // reset
+    const long clearBaseline = measure("memset" + suffix, "reset", "uint8_t", SIZE, 1, -1,
+        selected({"reset" + suffix, "reset_clearBuffer" + suffix}, "reset"), [&] {
+        uint8_t buffer[SIZE];
+        clobberMemory();
+        memset(buffer, 0, SIZE);
+        doNotOptimize(buffer);
+    });
+    measure("reset" + suffix, "reset", "uint8_t", SIZE, 1, clearBaseline, false, [&] {
+        clobberMemory();
+        full.reset();
+        doNotOptimize(full);
+    });
+    measure("reset_clearBuffer" + suffix, "reset", "uint8_t", SIZE, 1, clearBaseline, false, [&] {
+        clobberMemory();
+        full.reset(true);
+        doNotOptimize(full);
+    });
+    measure("reset_src" + suffix, "reset", "uint8_t", SIZE, 1, copyBaseline, false, [&] {
+        clobberMemory();
+        full.reset(source);
+        doNotOptimize(full);
+    });
+}
+
+template <size_t SIZE> static void benchAll()
+{
+    benchSize<SIZE>();
+    benchType<uint8_t, SIZE>();
+    benchType<uint16_t, SIZE>();
+    benchType<uint32_t, SIZE>();
+    benchType<uint64_t, SIZE>();
+    benchType<float, SIZE>();
+    benchType<double, SIZE>();
+    benchType<BenchRecord, SIZE>();
+}
+
+static void printCsv()
+{
+    printf("name,group,type,size,median_ns,min_ns,baseline,ratio\n");
+    for (const BenchResult& result : g_Results)
+    {
+        const BenchResult* baseline = result.baseline >= 0 ? &g_Results[result.baseline] : nullptr;
+        printf("%s,%s,%s,%zu,%.3f,%.3f,%s,%.3f\n", result.name.c_str(), result.group.c_str(), result.type.c_str(),
+            result.size, result.medianNs, result.minNs, baseline != nullptr ? baseline->name.c_str() : "",
+            baseline != nullptr ? result.medianNs / baseline->medianNs : 1.0);
+    }
+}
+
+static void printJson()
+{
+    printf("[\n");
+    for (size_t i = 0; i < g_Results.size(); i++)
+    {
+        const BenchResult& result = g_Results[i];
+        const BenchResult* baseline = result.baseline >= 0 ? &g_Results[result.baseline] : nullptr;
+        printf("  {\"name\": \"%s\", \"group\": \"%s\", \"type\": \"%s\", \"size\": %zu, \"median_ns\": %.3f, "
+               "\"min_ns\": %.3f, \"baseline\": %s%s%s, \"ratio\": %.3f}%s\n",
+            result.name.c_str(), result.group.c_str(), result.type.c_str(), result.size, result.medianNs, result.minNs,
+            baseline != nullptr ? "\"" : "", baseline != nullptr ? baseline->name.c_str() : "null",
+            baseline != nullptr ? "\"" : "", baseline != nullptr ? result.medianNs / baseline->medianNs : 1.0,
+            i + 1 < g_Results.size() ? "," : "");
+    }
+    printf("]\n");
+}
+
+int main(const int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--json")
+        {
+            g_Options.json = true;
+        }
+        else if (argument.rfind("--filter=", 0) == 0)
+        {
+            g_Options.filter = argument.substr(9);
+        }
+        else if (argument.rfind("--min-time-ms=", 0) == 0)
+        {
+            g_Options.minTimeMs = std::atof(argument.c_str() + 14);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--filter=SUBSTRING] [--min-time-ms=N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    benchAll<8>();
+    benchAll<64>();
+    benchAll<512>();
+
+    if (g_Options.json)
+    {
+        printJson();
+    }
+    else
+    {
+        printCsv();
+    }
+    return 0;
+}
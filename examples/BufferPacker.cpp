@@ -163,6 +163,8 @@ void heapOwnershipExample()
     printComparison(packValueCheck[1], heapBuffer[1]);
     printComparison(packValueCheck[2], heapBuffer[2]);
     printComparison(packValueCheck[3], heapBuffer[3]);
+
+    delete[] heapBuffer;
 }
 
 void resetValuesExample()
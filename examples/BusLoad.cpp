@@ -0,0 +1,41 @@
+#include <Arduino.h>
+#include "BusLoad.h"
+#include "Reserved.h"
+
+void busLoadFrameBitsExample()
+{
+    // Worst case for an 8-byte standard frame is the well-known 135 bits
+    printComparison(static_cast<uint32_t>(135), worstCaseFrameBits(8, false));
+
+    // An all-zero payload needs lots of stuff bits, but never more than the worst case
+    CanFrame zeros;
+    zeros.id = StartSwitchId;
+    zeros.len = 8;
+    const uint32_t zeroBits = exactFrameBits(zeros);
+    printComparison(true, zeroBits > 111 && zeroBits <= 135);
+}
+
+void busLoadMonitorExample()
+{
+    // 1 second window made of 10 buckets of 100 ms
+    BusLoadMonitor<10> busLoad(100);
+
+    CanFrame throttle;
+    throttle.id = Throttle1PositionId;
+    throttle.len = 2;
+
+    // 1 frame per millisecond for 1 second
+    for (uint32_t ms = 0; ms < 1000; ms++)
+    {
+        busLoad.record(throttle, ms);
+    }
+    printComparison(static_cast<uint32_t>(1000), busLoad.getWindowFrames(Throttle1PositionId));
+
+    // ~60 bits per frame at 1000 frames/s on a 1 Mbit/s bus is roughly 6% of the bus
+    const uint32_t permille = busLoad.getUtilizationPermille(Throttle1PositionId);
+    printComparison(true, permille >= 50 && permille <= 80);
+
+    // Half a second later, half of the window has slid past the burst
+    busLoad.advance(1500);
+    printComparison(static_cast<uint32_t>(400), busLoad.getWindowFrames(Throttle1PositionId));
+}
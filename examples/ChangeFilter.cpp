@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include "ChangeFilter.h"
+#include "Reserved.h"
+
+void changeFilterExample()
+{
+    // BMS percentage (uint8_t) followed by temperature (float), sent at least once every 1000 ms
+    ChangeFilter<2> filter(1000);
+    filter.addField<uint8_t>(0, 1);
+    filter.addField<float>(1, 0.5f);
+
+    auto packBms = [](const uint8_t percentage, const float temperature)
+    {
+        BufferPacker<sizeof(uint8_t) + sizeof(float)> packer;
+        packer.pack(percentage);
+        packer.pack(temperature);
+        CanFrame frame;
+        frame.pack(BMSPercentageId, packer);
+        return frame;
+    };
+
+    // The first frame is always sent
+    printComparison(true, filter.shouldSend(packBms(80, 30.0f), 0));
+    // Changes inside the deadbands are suppressed
+    printComparison(false, filter.shouldSend(packBms(81, 30.4f), 10));
+    // Temperature drifted further than 0.5 from the last sent value
+    printComparison(true, filter.shouldSend(packBms(81, 30.6f), 20));
+    // Nothing changed, but the maximum silence interval ran out
+    printComparison(true, filter.shouldSend(packBms(81, 30.6f), 1020));
+    printComparison(static_cast<uint32_t>(1), filter.getSuppressedCount());
+}
+
+void changeFilterWholeFrameExample()
+{
+    // No fields configured - any byte difference counts as a change
+    ChangeFilter<> filter(500);
+
+    CanFrame frame;
+    frame.id = TireTemperatureId;
+    frame.len = 2;
+
+    printComparison(true, filter.shouldSend(frame, 0));
+    printComparison(false, filter.shouldSend(frame, 100));
+    frame.buf[1] = 1;
+    printComparison(true, filter.shouldSend(frame, 200));
+}
@@ -0,0 +1,74 @@
+#include <Arduino.h>
+#include "Cobs.h"
+#include "BufferPacker.h"
+
+void cobsExample()
+{
+    // A frame record encoded field by field, straight out of the CanFrame
+    CanFrame frame;
+    frame.id = CurrentInfoId;
+    frame.timestamp = 0x00012300;
+    frame.len = 8;
+    const uint8_t payload[8] = {0x00, 0x11, 0x00, 0x00, 0x22, 0x33, 0x00, 0x44};
+    memcpy(frame.buf, payload, sizeof(payload));
+
+    uint8_t tx[cobsEncodedSize(sizeof(frame.id) + sizeof(frame.timestamp) + CAN_MAX_DLC)];
+    CobsEncoder encoder(tx);
+    encoder.append(frame.id);
+    encoder.append(frame.timestamp);
+    encoder.append(frame.buf, frame.len);
+    const size_t encoded = encoder.finish();
+    printComparison(static_cast<size_t>(18), encoded);
+    printComparison(true, memchr(tx, COBS_DELIMITER, encoded - 1) == nullptr);
+    printComparison(static_cast<uint8_t>(COBS_DELIMITER), tx[encoded - 1]);
+
+    // A BufferPacker payload goes through the one-shot encoder
+    BufferPacker<16> packer;
+    packer.pack(static_cast<uint16_t>(1234));
+    packer.pack(-1.5f);
+    packer.pack(static_cast<uint8_t>(0));
+    uint8_t packed[16];
+    packer.deepCopyTo(packed);
+    uint8_t tx2[cobsEncodedSize(sizeof(packed))];
+    const size_t encoded2 = cobsEncode(packed, 7, tx2, sizeof(tx2));
+    printComparison(true, encoded2 > 0);
+
+    // The receiver gets the stream in arbitrary pieces, with line noise in front
+    uint8_t stream[64];
+    size_t streamSize = 0;
+    const uint8_t noise[3] = {0x55, 0x12, COBS_DELIMITER};
+    memcpy(stream, noise, sizeof(noise));
+    streamSize += sizeof(noise);
+    memcpy(stream + streamSize, tx, encoded);
+    streamSize += encoded;
+    memcpy(stream + streamSize, tx2, encoded2);
+    streamSize += encoded2;
+
+    CobsDecoder<4, 32> decoder;
+    size_t packets = 0;
+    for (size_t offset = 0; offset < streamSize; offset += 5)
+    {
+        packets += decoder.feed(stream + offset, streamSize - offset < 5 ? streamSize - offset : 5);
+    }
+    printComparison(static_cast<size_t>(2), packets);
+    // The noise ends in a delimiter mid-block and counts as one malformed packet
+    printComparison(static_cast<uint32_t>(1), decoder.getErrorCount());
+
+    CobsPacket<32> packet;
+    decoder.getPackets().pop(packet);
+    printComparison(static_cast<uint16_t>(16), packet.size);
+    uint32_t id = 0;
+    memcpy(&id, packet.data, sizeof(id));
+    printComparison(static_cast<uint32_t>(CurrentInfoId), id);
+    printComparison(0, memcmp(packet.data + 8, payload, sizeof(payload)));
+
+    decoder.getPackets().pop(packet);
+    BufferPacker<16> unpacker(packet.data, packet.size);
+    printComparison(static_cast<uint16_t>(1234), unpacker.unpack<uint16_t>());
+    printComparison(-1.5f, unpacker.unpack<float>());
+
+    // A packet cut short by a delimiter is discarded
+    const uint8_t truncated[4] = {0x05, 0x01, 0x02, COBS_DELIMITER};
+    printComparison(static_cast<size_t>(0), decoder.feed(truncated, sizeof(truncated)));
+    printComparison(static_cast<uint32_t>(2), decoder.getErrorCount());
+}
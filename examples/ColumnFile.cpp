@@ -0,0 +1,61 @@
+#include <Arduino.h>
+#include "ColumnFile.h"
+#include "FrameLog.h"
+#include "MuxCodec.h"
+#include "Reserved.h"
+
+void columnFileExample()
+{
+    // Uses MemoryStorageExample from the frame log example
+    static MemoryStorageExample<16384> logStorage;
+    static MemoryStorageExample<4096> columnStorage;
+    logStorage.length = 0;
+    columnStorage.length = 0;
+
+    // Record tire RPMs as batched frames, interleaved with throttle frames
+    FrameLogWriter<MemoryStorageExample<16384>, 512, 8> writer(logStorage);
+    writer.begin();
+    TireRpmCodec tireRpm;
+    for (uint32_t ms = 0; ms < 200; ms++)
+    {
+        CanFrame throttle;
+        throttle.id = Throttle1PositionId;
+        throttle.len = sizeof(uint16_t);
+        writer.append(throttle, ms * 1000ull);
+        if (ms % 10 == 0)
+        {
+            tireRpm.setSlot(FrontRightId, static_cast<uint16_t>(1000 + ms));
+            CanFrame batch;
+            tireRpm.encodeBatch(TireRPMId, FrontLeftId, batch);
+            writer.append(batch, ms * 1000ull + 1);
+        }
+    }
+    writer.close();
+
+    // Split the front right wheel out of the multiplexed frames into its own column
+    FrameLogReader<MemoryStorageExample<16384>, 512> reader(logStorage);
+    reader.open();
+    const uint64_t count = transcodeColumn<uint16_t>(reader, columnStorage, "tire_rpm_fr", TireRPMId,
+        ColumnMuxField<TireRpmCodec, TireSubIDs>{FrontRightId});
+    printComparison(static_cast<uint64_t>(20), count);
+
+    // Read the column in place, the way a memory-mapped file would be
+    const ColumnView column(columnStorage.bytes, columnStorage.length);
+    printComparison(true, static_cast<bool>(column));
+    printComparison(static_cast<uint64_t>(20), column.getCount());
+    printComparison(true, column.values<int16_t>() == nullptr);
+    const uint16_t* values = column.values<uint16_t>();
+    const uint64_t* timestamps = column.timestamps();
+    printComparison(static_cast<uint16_t>(1190), values[19]);
+    printComparison(static_cast<uint64_t>(190001), timestamps[19]);
+    printComparison(static_cast<size_t>(0), (reinterpret_cast<const uint8_t*>(values) - columnStorage.bytes) % COLUMN_FILE_ALIGNMENT);
+
+    // A header whose value size doesn't match its type is rejected instead of read past the end
+    static MemoryStorageExample<4096> corrupted;
+    memcpy(corrupted.bytes, columnStorage.bytes, columnStorage.length);
+    corrupted.bytes[7] = 1;
+    printComparison(false, static_cast<bool>(ColumnView(corrupted.bytes, columnStorage.length)));
+
+    // So is a header whose offsets point past the end of a truncated file
+    printComparison(false, static_cast<bool>(ColumnView(columnStorage.bytes, COLUMN_FILE_HEADER_SIZE)));
+}
@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include "Downsampler.h"
+#include "Reserved.h"
+
+void downsamplerBucketExample()
+{
+    Downsampler<> downsampler;
+    printComparison(true, downsampler.configure(Throttle1PositionId, DownsampleMode::Bucket, 10));
+    printComparison(false, downsampler.isConfigured(Throttle2PositionId));
+
+    // A one-sample spike survives downsampling in the bucket's max
+    DownsampleSample out = {};
+    size_t outputs = 0;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        const int32_t throttle = i == 42 ? 4000 : 1000;
+        if (downsampler.push(Throttle1PositionId, throttle, out))
+        {
+            outputs++;
+            if (i == 49)
+            {
+                printComparison(static_cast<int32_t>(4000), out.max);
+                printComparison(static_cast<int32_t>(1300), out.value);
+            }
+        }
+    }
+    printComparison(static_cast<size_t>(10), outputs);
+    printComparison(static_cast<int32_t>(1000), out.min);
+    printComparison(false, downsampler.push(Throttle2PositionId, 1000, out));
+}
+
+void downsamplerFirExample()
+{
+    Downsampler<4, 16> downsampler;
+    downsampler.configure(SteeringWheelAngleId, DownsampleMode::Fir, 4);
+
+    // Steady angle plus noise at the input Nyquist frequency, which every-4th-sample decimation would alias to DC
+    int32_t angles[256];
+    for (size_t i = 0; i < 256; i++)
+    {
+        angles[i] = i % 2 == 0 ? 1200 : 800;
+    }
+    DownsampleSample out[64];
+    const size_t outputs = downsampler.process(SteeringWheelAngleId, angles, 256, out);
+    printComparison(static_cast<size_t>(64), outputs);
+
+    // Once the filter has settled, the noise is gone and the mean remains
+    bool settled = true;
+    for (size_t i = 8; i < outputs; i++)
+    {
+        settled &= out[i].value >= 995 && out[i].value <= 1005;
+    }
+    printComparison(true, settled);
+}
@@ -0,0 +1,50 @@
+#include <Arduino.h>
+#include "FaultEngine.h"
+#include "Reserved.h"
+
+void faultEngineExample()
+{
+    FaultEngine faults;
+
+    // Brake sensor must read zero for 3 consecutive samples before the fault activates
+    faults.setDebounce(BrakeZeroId, 3, 3);
+    faults.report(BrakeZeroId, true);
+    faults.report(BrakeZeroId, true);
+    printComparison(false, faults.isActive(BrakeZeroId));
+    faults.report(BrakeZeroId, true);
+    printComparison(true, faults.isActive(BrakeZeroId));
+
+    // A latched fault can't be cleared while it is still active
+    printComparison(false, faults.clear(BrakeZeroId));
+
+    // Once the sensor recovers, the fault stays latched until it is cleared
+    faults.report(BrakeZeroId, false);
+    faults.report(BrakeZeroId, false);
+    faults.report(BrakeZeroId, false);
+    printComparison(false, faults.isActive(BrakeZeroId));
+    printComparison(true, faults.isLatched(BrakeZeroId));
+    printComparison(true, faults.clear(BrakeZeroId));
+    printComparison(false, faults.any());
+}
+
+void faultEngineFrameExample()
+{
+    FaultEngine faults;
+    faults.raise(ThrottleMismatchId);
+    faults.raise(StartFaultId);
+
+    // The whole fault state fits in one FaultId frame
+    CanFrame frame;
+    if (faults.hasChanged())
+    {
+        faults.packFrame(frame);
+    }
+    printComparison(false, faults.hasChanged());
+
+    uint8_t active = 0;
+    uint8_t latched = 0;
+    FaultEngine::unpackFrame(frame, active, latched);
+    printComparison(static_cast<uint32_t>(FaultId), frame.id);
+    printComparison(static_cast<uint8_t>(faultBit(ThrottleMismatchId) | faultBit(StartFaultId)), active);
+    printComparison(active, latched);
+}
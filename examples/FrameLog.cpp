@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include "FrameLog.h"
+#include "Reserved.h"
+
+/** Minimal in-memory storage backend - on the car this would wrap an SD card file */
+template <size_t CAPACITY> struct MemoryStorageExample
+{
+    /** Aligned like a memory-mapped file, so columns can be read in place */
+    alignas(8) uint8_t bytes[CAPACITY] = {};
+    size_t length = 0;
+
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        const size_t count = length + size <= CAPACITY ? size : 0;
+        memcpy(&bytes[length], data, count);
+        length += count;
+        return count;
+    }
+
+    size_t read(const uint64_t offset, uint8_t* data, const size_t size)
+    {
+        const size_t count = offset + size <= length ? size : 0;
+        memcpy(data, &bytes[offset], count);
+        return count;
+    }
+
+    uint64_t size() const
+    {
+        return length;
+    }
+};
+
+void frameLogExample()
+{
+    static MemoryStorageExample<16384> storage;
+    storage.length = 0;
+
+    // Record 500 ms of throttle at 1 kHz, with a tire RPM frame every 100 ms, in 512-byte chunks
+    FrameLogWriter<MemoryStorageExample<16384>, 512, 8> writer(storage);
+    writer.begin();
+    for (uint32_t ms = 0; ms < 500; ms++)
+    {
+        CanFrame frame;
+        frame.id = ms % 100 == 0 ? TireRPMId : Throttle1PositionId;
+        frame.len = sizeof(uint32_t);
+        memcpy(frame.buf, &ms, sizeof(ms));
+        writer.append(frame, ms * 1000ull);
+    }
+    writer.close();
+
+    FrameLogReader<MemoryStorageExample<16384>, 512> reader(storage);
+    printComparison(true, reader.open());
+    printComparison(true, reader.hasIndex());
+
+    // Extract a single ID - only the chunks containing it are read
+    const size_t tireFrames = reader.query(0, UINT64_MAX, frameLogIdBit(TireRPMId), [](const CanFrame&, uint64_t) {});
+    printComparison(static_cast<size_t>(5), tireFrames);
+    printComparison(true, reader.getChunksRead() < reader.getChunkCount());
+
+    // Seek to a 10 ms window - the index narrows it down to one or two chunks
+    uint32_t firstMs = 0;
+    const size_t windowFrames = reader.query(250000, 259999, FrameLogReader<MemoryStorageExample<16384>>::ALL_IDS,
+        [&firstMs](const CanFrame&, const uint64_t timestampUs)
+        {
+            if (firstMs == 0)
+            {
+                firstMs = static_cast<uint32_t>(timestampUs / 1000);
+            }
+        });
+    printComparison(static_cast<size_t>(10), windowFrames);
+    printComparison(static_cast<uint32_t>(250), firstMs);
+    printComparison(true, reader.getChunksRead() <= 2);
+}
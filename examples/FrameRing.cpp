@@ -0,0 +1,57 @@
+#include <Arduino.h>
+#include "FrameRing.h"
+#include "Reserved.h"
+
+void frameRingExample()
+{
+    // Ring with room for 4 frames - the CAN ISR is the producer, loop() is the consumer
+    FrameRing<4> ring;
+
+    // Simulated ISR: pack a throttle reading and push it into the ring
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        BufferPacker<sizeof(uint16_t)> packer;
+        packer.pack(static_cast<uint16_t>(100 + i));
+
+        CanFrame frame;
+        frame.pack(Throttle1PositionId, packer);
+        ring.push(frame);
+    }
+
+    // Batch drain in loop() - every frame is handled in place
+    uint16_t expectedValue = 100;
+    const size_t drained = ring.drain([&expectedValue](const CanFrame& frame)
+    {
+        auto unpacker = frame.unpacker();
+        printComparison(expectedValue++, unpacker.unpack<uint16_t>());
+    });
+    printComparison(static_cast<size_t>(3), drained);
+    printComparison(static_cast<uint32_t>(3), ring.getHighWaterMark());
+
+    // A full-size packer that is only partly filled gives a frame as long as what was packed
+    BufferPacker<CAN_MAX_DLC> partial;
+    partial.pack(static_cast<uint16_t>(200));
+    CanFrame shortFrame;
+    shortFrame.pack(Throttle2PositionId, partial);
+    printComparison(static_cast<uint8_t>(sizeof(uint16_t)), shortFrame.len);
+}
+
+void frameRingOverflowExample()
+{
+    FrameRing<2> ring;
+    CanFrame frame;
+    frame.id = BrakePressureId;
+
+    // The third push does not fit and is counted as a drop instead of overwriting older frames
+    ring.push(frame);
+    ring.push(frame);
+    const bool pushed = ring.push(frame);
+
+    printComparison(false, pushed);
+    printComparison(static_cast<uint32_t>(1), ring.getDropCount());
+
+    // Drain into a plain array
+    CanFrame frames[2];
+    printComparison(static_cast<size_t>(2), ring.drain(frames, 2));
+    printComparison(true, ring.empty());
+}
@@ -0,0 +1,37 @@
+#include <Arduino.h>
+#include "HealthCheck.h"
+#include "Reserved.h"
+
+/** Simulated responder - echoes the HealthCheckId payload back under its own ID */
+CanFrame echoHealthCheck(const CanFrame& request, const ReservedIDs responderId)
+{
+    CanFrame response = request;
+    response.id = responderId;
+    return response;
+}
+
+void healthCheckExample()
+{
+    // Responders have 10 ms to answer
+    HealthCheckClient<> health(10000);
+
+    CanFrame request;
+    health.sendRequest(1000, request);
+
+    // DCF answers after 150 us, DCR after 900 us, DCT never answers
+    printComparison(true, health.handleResponse(echoHealthCheck(request, DCFId), 1150));
+    printComparison(true, health.handleResponse(echoHealthCheck(request, DCRId), 1900));
+
+    // Duplicate responses don't match anything
+    printComparison(false, health.handleResponse(echoHealthCheck(request, DCFId), 2000));
+
+    // After the timeout, the missing DCT response counts as a timeout
+    health.poll(20000);
+    printComparison(static_cast<uint32_t>(150), health.getStats(DCFId).maxUs);
+    printComparison(static_cast<uint32_t>(900), health.getStats(DCRId).maxUs);
+    printComparison(static_cast<uint32_t>(1), health.getStats(DCTId).timeouts);
+    printComparison(static_cast<size_t>(0), health.getOutstanding());
+
+    // 150 us falls into the [128, 256) us bucket
+    printComparison(static_cast<uint32_t>(1), health.getStats(DCFId).histogram[7]);
+}
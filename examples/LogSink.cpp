@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include "FrameLog.h"
+#include "LogSink.h"
+#include "VirtualClock.h"
+
+/** Clock the slow storage below advances, standing in for micros() */
+VirtualClock logSinkClock;
+
+/** Storage that takes 3 ms per write, like an SD card during a busy period */
+struct SlowStorageExample
+{
+    size_t bytes = 0;
+
+    size_t write(const uint8_t*, const size_t size)
+    {
+        logSinkClock.advance(3000);
+        bytes += size;
+        return size;
+    }
+};
+
+void logSinkExample()
+{
+    logSinkClock.set(0);
+    SlowStorageExample storage;
+    LogSink<SlowStorageExample, 1024> sink(storage, [] { return logSinkClock.micros(); });
+
+    // 100 frames of 18-byte records fill the first buffer and hand it off without touching storage
+    FrameLogWriter<LogSink<SlowStorageExample, 1024>, 512, 8> writer(sink);
+    printComparison(true, writer.begin());
+    CanFrame frame;
+    frame.id = Throttle1PositionId;
+    frame.len = sizeof(uint16_t);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        writer.append(frame, i * 1000ull);
+    }
+    printComparison(static_cast<size_t>(0), storage.bytes);
+    printComparison(static_cast<uint32_t>(0), logSinkClock.micros());
+
+    // Idle time writes the full buffer; the control loop never saw the 3 ms
+    printComparison(static_cast<size_t>(1024), sink.service());
+    printComparison(static_cast<uint32_t>(3000), sink.getStats().maxFlushUs);
+
+    // Records that don't fit while storage is behind are dropped instead of blocking
+    size_t accepted = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        BufferPacker<512> bulk;
+        accepted += sink.append(bulk);
+    }
+    printComparison(true, accepted < 8);
+    printComparison(static_cast<uint32_t>(8 - accepted), sink.getDropCount());
+    printComparison(true, sink.getHighWaterMark() <= 2048);
+
+    // Shutdown writes the rest: the file header, three full chunks and the bulk records that were accepted
+    sink.flush();
+    printComparison(static_cast<size_t>(FRAME_LOG_HEADER_SIZE + 3 * 512 + accepted * 512), storage.bytes);
+}
+
+void logSinkStarvedExample()
+{
+    MemoryStorageExample<16384> storage;
+    LogSink<MemoryStorageExample<16384>, 1024> sink(storage, [] { return static_cast<uint32_t>(0); });
+    FrameLogWriter<LogSink<MemoryStorageExample<16384>, 1024>, 512, 8> writer(sink);
+    printComparison(true, writer.begin());
+
+    // 300 frames without a single service() call: once both buffers are full, whole chunks are dropped
+    constexpr uint32_t FRAMES = 300;
+    CanFrame frame;
+    frame.id = Throttle1PositionId;
+    frame.len = sizeof(uint32_t);
+    bool appended = true;
+    for (uint32_t i = 0; i < FRAMES; i++)
+    {
+        memcpy(frame.buf, &i, sizeof(i));
+        appended &= writer.append(frame, i * 1000ull);
+        // Storage catches up two thirds of the way in
+        if (i == 200)
+        {
+            sink.service();
+            sink.service();
+        }
+    }
+    printComparison(true, appended);
+    printComparison(true, writer.getDroppedChunkCount() > 0);
+
+    // Storage catches up again before shutdown, so the last chunk and the index make it
+    sink.service();
+    sink.service();
+    const uint32_t droppedChunks = writer.getDroppedChunkCount();
+    printComparison(true, writer.close());
+    printComparison(droppedChunks, writer.getDroppedChunkCount());
+    sink.flush();
+
+    // The log is still complete apart from the dropped chunks, and its index is intact
+    FrameLogReader<MemoryStorageExample<16384>, 512> reader(storage);
+    printComparison(true, reader.open());
+    printComparison(true, reader.hasIndex());
+    printComparison(writer.getChunkCount(), reader.getChunkCount());
+    uint32_t lastValue = 0;
+    bool ascending = true;
+    const size_t frames = reader.query(0, UINT64_MAX, FrameLogReader<MemoryStorageExample<16384>, 512>::ALL_IDS,
+        [&](const CanFrame& logged, uint64_t) {
+            uint32_t value;
+            memcpy(&value, logged.buf, sizeof(value));
+            ascending &= value >= lastValue;
+            lastValue = value;
+        });
+    const size_t recordsPerChunk = FrameLogWriter<MemoryStorageExample<16384>, 512, 8>::RECORDS_PER_CHUNK;
+    printComparison(static_cast<size_t>(FRAMES - writer.getDroppedChunkCount() * recordsPerChunk), frames);
+    printComparison(true, ascending);
+    printComparison(FRAMES - 1, lastValue);
+}
@@ -0,0 +1,69 @@
+#include <Arduino.h>
+#include "MessageBus.h"
+#include "VirtualClock.h"
+
+/** Clock the handlers below advance, standing in for micros() */
+VirtualClock messageBusClock;
+
+/** Latest phase A current seen by the handlers below */
+struct MessageBusState
+{
+    float phaseACurrent = 0;
+    uint32_t frames = 0;
+};
+
+void messageBusExample()
+{
+    MessageBus<8> bus([] { return messageBusClock.micros(); });
+    MessageBusState state;
+
+    const size_t currentHandle = bus.subscribe<CurrentInfoMessage>(
+        [](const CurrentInfoMessage& message, void* context) {
+            messageBusClock.advance(20);
+            static_cast<MessageBusState*>(context)->phaseACurrent = message.getPhaseACurrent();
+        },
+        &state);
+    const size_t frameHandle = bus.subscribe(
+        CurrentInfoId,
+        [](const CanFrame&, void* context) {
+            messageBusClock.advance(5);
+            static_cast<MessageBusState*>(context)->frames++;
+        },
+        &state);
+    const size_t voltageHandle = bus.subscribe(VoltageInfoId, [](const CanFrame&, void*) {}, nullptr);
+    const bool subscribed = currentHandle != MessageBus<8>::INVALID_HANDLER &&
+        frameHandle != MessageBus<8>::INVALID_HANDLER && voltageHandle != MessageBus<8>::INVALID_HANDLER;
+    printComparison(true, subscribed);
+    if (!subscribed)
+    {
+        return;
+    }
+    printComparison(static_cast<size_t>(2), bus.getSubscriberCount(CurrentInfoId));
+    printComparison(static_cast<size_t>(3), bus.getHandlerCount());
+
+    // One decode, two handlers
+    CurrentInfoMessage current;
+    current.setPhaseACurrent(42.5f);
+    CanFrame frame;
+    pack(current, frame);
+    printComparison(static_cast<size_t>(2), bus.publish(frame));
+    printComparison(static_cast<size_t>(2), bus.publish(frame));
+    printComparison(425, static_cast<int>(lround(state.phaseACurrent * 10)));
+    printComparison(static_cast<uint32_t>(2), state.frames);
+
+    // A short frame still reaches the raw handler, but not the typed one
+    frame.len = 4;
+    printComparison(static_cast<size_t>(1), bus.publish(frame));
+    printComparison(static_cast<uint32_t>(1), bus.getDecodeErrorCount());
+
+    // Nobody listens to ID 0x7FF
+    frame.id = 0x7FF;
+    printComparison(static_cast<size_t>(0), bus.publish(frame));
+    printComparison(static_cast<uint32_t>(1), bus.getUnroutedCount());
+
+    const MessageHandlerStats* currentStats = bus.getStats(currentHandle);
+    printComparison(static_cast<uint32_t>(2), currentStats->calls);
+    printComparison(static_cast<uint32_t>(20), currentStats->maxTicks);
+    printComparison(static_cast<uint32_t>(3), bus.getStats(frameHandle)->calls);
+    printComparison(static_cast<uint64_t>(15), bus.getStats(frameHandle)->totalTicks);
+}
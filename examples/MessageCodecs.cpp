@@ -0,0 +1,53 @@
+#include <Arduino.h>
+#include "MessageCodecs.h"
+
+void messageCodecsExample()
+{
+    // Byte-aligned signals: one memcpy per signal
+    CurrentInfoMessage current;
+    current.setPhaseACurrent(-123.4f);
+    current.setDcBusCurrent(56.7f);
+
+    CanFrame frame;
+    pack(current, frame);
+    printComparison(static_cast<uint32_t>(CurrentInfoId), frame.id);
+    printComparison(static_cast<uint8_t>(8), frame.len);
+
+    CurrentInfoMessage decodedCurrent;
+    printComparison(true, unpack(frame, decodedCurrent));
+    printComparison(static_cast<int16_t>(-1234), decodedCurrent.phaseACurrent);
+    printComparison(static_cast<int16_t>(567), decodedCurrent.dcBusCurrent);
+
+    // Packed 10-bit signals: shifted out of one 64-bit word
+    AnalogInputVoltagesMessage analog;
+    analog.setAnalogInput1(4.5f);
+    analog.setAnalogInput4(1.23f);
+    analog.setAnalogInput6(10.23f);
+    pack(analog, frame);
+
+    AnalogInputVoltagesMessage decodedAnalog;
+    printComparison(true, unpack(frame, decodedAnalog));
+    printComparison(static_cast<uint16_t>(450), decodedAnalog.analogInput1);
+    printComparison(static_cast<uint16_t>(0), decodedAnalog.analogInput2);
+    printComparison(static_cast<uint16_t>(123), decodedAnalog.analogInput4);
+    printComparison(static_cast<uint16_t>(1023), decodedAnalog.analogInput6);
+
+    // Single-bit flags next to signed torque values
+    ControlCommandMessage command;
+    command.setTorqueCommand(-25.5f);
+    command.inverterEnable = true;
+    pack(command, frame);
+
+    ControlCommandMessage decodedCommand;
+    printComparison(true, unpack(frame, decodedCommand));
+    printComparison(static_cast<int16_t>(-255), decodedCommand.torqueCommand);
+    printComparison(true, decodedCommand.inverterEnable);
+    printComparison(false, decodedCommand.inverterDischarge);
+
+    // A frame with another ID is rejected
+    printComparison(false, unpack(frame, decodedCurrent));
+
+    // Per-ID metadata from the same DBC file
+    printComparison(static_cast<uint32_t>(3), reservedIdInfo(CurrentInfoId)->periodMs);
+    printComparison(true, reservedIdInfo(0x7FF) == nullptr);
+}
@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include "MuxCodec.h"
+#include "Reserved.h"
+
+void muxCodecExample()
+{
+    // Sender side - a single sub-ID per frame
+    RvcCodec sender;
+    sender.setSlot(PitchId, 2.5f);
+
+    CanFrame frame;
+    sender.encode(RVCId, PitchId, frame);
+
+    // Receiver side - the mux byte selects the slot through the jump table
+    RvcCodec receiver;
+    receiver.decode(frame);
+
+    printComparison(2.5f, receiver.getSlot(PitchId));
+    printComparison(static_cast<uint16_t>(1u << PitchId), receiver.getUpdatedMask());
+}
+
+void muxCodecBatchExample()
+{
+    // Sender side - all four tires packed into as few frames as possible
+    TireRpmCodec sender;
+    sender.setSlot(FrontLeftId, 1000);
+    sender.setSlot(FrontRightId, 1001);
+    sender.setSlot(RearLeftId, 1002);
+    sender.setSlot(RearRightId, 1003);
+
+    CanFrame frames[4];
+    const size_t frameCount = sender.encodeAll(TireRPMId, frames);
+
+    // 1 mux byte + 3 uint16_t values per frame
+    printComparison(static_cast<size_t>(2), frameCount);
+
+    // Receiver side
+    TireRpmCodec receiver;
+    for (size_t i = 0; i < frameCount; i++)
+    {
+        receiver.decode(frames[i]);
+    }
+    printComparison(static_cast<uint16_t>(1000), receiver.getSlot(FrontLeftId));
+    printComparison(static_cast<uint16_t>(1003), receiver.getSlot(RearRightId));
+    printComparison(static_cast<uint16_t>(0x0F), receiver.getUpdatedMask());
+}
@@ -0,0 +1,84 @@
+#include <Arduino.h>
+#include "ParameterClient.h"
+#include "FrameRing.h"
+#include "Reserved.h"
+
+/** Completion callback - counts finished requests and sums the values read */
+void onParameterComplete(const uint16_t address, const bool write, const ParameterStatus status, const uint16_t value, void* context)
+{
+    (void)address;
+    (void)write;
+    auto* results = static_cast<uint32_t*>(context);
+    if (status == ParameterStatus::Ok)
+    {
+        results[0]++;
+        results[1] += value;
+    } else if (status == ParameterStatus::TimedOut)
+    {
+        results[2]++;
+    }
+}
+
+/** Simulated motor controller - answers every read with the address times two, ignores address 99 */
+CanFrame answerParameterCommand(const CanFrame& command)
+{
+    auto unpacker = command.unpacker();
+    const auto address = unpacker.unpack<uint16_t>();
+
+    BufferPacker<CAN_MAX_DLC> packer;
+    packer.pack(address);
+    packer.pack(static_cast<uint8_t>(1));
+    packer.pack(static_cast<uint8_t>(0));
+    packer.pack(static_cast<uint16_t>(address * 2));
+    packer.pack(static_cast<uint16_t>(0));
+
+    CanFrame response;
+    response.pack(ParameterResponseId, packer);
+    return response;
+}
+
+void parameterClientExample()
+{
+    // Completed, sum of values, timed out
+    uint32_t results[3] = {};
+
+    // 4 requests in flight, 1 ms timeout, 2 retries
+    ParameterClient<4, 16> params(onParameterComplete, results, 1000, 2);
+    FrameRing<16> txRing;
+
+    for (uint16_t address = 1; address <= 8; address++)
+    {
+        params.read(address);
+    }
+    params.read(99);
+
+    // Each bus round trip answers a whole window of requests instead of a single one
+    uint32_t nowUs = 0;
+    uint32_t roundTrips = 0;
+    uint32_t roundTripsForReads = 0;
+    while (!params.idle())
+    {
+        params.poll(nowUs, txRing);
+        txRing.drain([&params, nowUs](const CanFrame& command)
+        {
+            auto unpacker = command.unpacker();
+            if (unpacker.unpack<uint16_t>() != 99)
+            {
+                params.handleResponse(answerParameterCommand(command), nowUs);
+            }
+        });
+        nowUs += 500;
+        roundTrips++;
+        if (roundTripsForReads == 0 && results[0] == 8)
+        {
+            roundTripsForReads = roundTrips;
+        }
+    }
+
+    printComparison(static_cast<uint32_t>(8), results[0]);
+    printComparison(static_cast<uint32_t>(72), results[1]);
+    printComparison(static_cast<uint32_t>(1), results[2]);
+    printComparison(static_cast<uint32_t>(2), params.getRetryCount());
+    // 8 reads in 2 round trips, where one request at a time would have needed 8
+    printComparison(static_cast<uint32_t>(2), roundTripsForReads);
+}
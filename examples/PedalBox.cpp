@@ -0,0 +1,52 @@
+#include <Arduino.h>
+#include "PedalBox.h"
+#include "BusLoad.h"
+
+void pedalBoxExample()
+{
+    PedalBoxSample sample;
+    sample.startSwitch = true;
+    sample.throttle1 = 1200;
+    sample.throttle2 = 1180;
+    sample.brakePressure = 310;
+
+    CanFrame perId[PEDAL_BOX_FRAME_COUNT];
+    CanFrame coalesced[PEDAL_BOX_FRAME_COUNT];
+    printComparison(static_cast<size_t>(4), packPedalBox(sample, PedalBoxMode::PerId, 0, 1000, perId));
+    printComparison(static_cast<size_t>(1), packPedalBox(sample, PedalBoxMode::Coalesced, 7, 1000, coalesced));
+    printComparison(static_cast<uint32_t>(PedalBoxId), coalesced[0].id);
+
+    // One frame on the wire instead of four
+    uint32_t perIdBits = 0;
+    for (const CanFrame& frame : perId)
+    {
+        perIdBits += exactFrameBits(frame);
+    }
+    printComparison(true, exactFrameBits(coalesced[0]) * 2 < perIdBits);
+
+    // The receiver gets back exactly the frames the per-ID mode would have sent
+    CanFrame expanded[PEDAL_BOX_FRAME_COUNT];
+    uint8_t counter = 0;
+    printComparison(static_cast<size_t>(4), expandPedalBox(coalesced[0], expanded, &counter));
+    printComparison(static_cast<uint8_t>(7), counter);
+    bool identical = true;
+    for (size_t i = 0; i < PEDAL_BOX_FRAME_COUNT; i++)
+    {
+        identical = identical && expanded[i].id == perId[i].id && expanded[i].len == perId[i].len &&
+                    expanded[i].timestamp == perId[i].timestamp && memcmp(expanded[i].buf, perId[i].buf, 8) == 0;
+    }
+    printComparison(true, identical);
+
+    Throttle1PositionMessage throttle1;
+    printComparison(true, unpack(expanded[1], throttle1));
+    printComparison(static_cast<uint16_t>(1200), throttle1.position);
+
+    // Out-of-range ADC readings saturate, and other frames aren't expanded
+    sample.brakePressure = 5000;
+    packPedalBox(sample, PedalBoxMode::Coalesced, 8, 2000, coalesced);
+    expandPedalBox(coalesced[0], expanded);
+    BrakePressureMessage brakePressure;
+    unpack(expanded[3], brakePressure);
+    printComparison(static_cast<uint16_t>(4095), brakePressure.pressure);
+    printComparison(static_cast<size_t>(0), expandPedalBox(perId[0], expanded));
+}
@@ -0,0 +1,43 @@
+#include <Arduino.h>
+#include "Probe.h"
+
+/** Sections of the control loop timed by probeExample() */
+enum ExampleProbe : size_t
+{
+    ExampleRxProbe,
+    ExampleTxProbe,
+    EXAMPLE_PROBE_COUNT
+};
+
+void probeExample()
+{
+    ProbeTable<EXAMPLE_PROBE_COUNT> probes;
+
+    // Runs of 100, 300 and 200 ticks
+    probes.record(ExampleRxProbe, 100);
+    probes.record(ExampleRxProbe, 300);
+    probes.record(ExampleRxProbe, 200);
+    const ProbeTable<EXAMPLE_PROBE_COUNT>::Stats& rx = probes.getStats(ExampleRxProbe);
+    printComparison(static_cast<uint32_t>(3), rx.count);
+    printComparison(static_cast<uint32_t>(100), rx.minTicks);
+    printComparison(static_cast<uint32_t>(300), rx.maxTicks);
+    printComparison(static_cast<uint64_t>(200), rx.totalTicks / rx.count);
+
+    // 100 falls into the [64, 128) bucket, 200 and 300 into [128, 256) and [256, 512)
+    printComparison(static_cast<uint32_t>(1), rx.histogram[6]);
+    printComparison(static_cast<uint32_t>(1), rx.histogram[7]);
+    printComparison(static_cast<uint32_t>(1), rx.histogram[8]);
+
+    // Unknown probes are rejected
+    printComparison(false, probes.record(EXAMPLE_PROBE_COUNT, 1));
+
+    // A scoped probe records one run when it leaves scope, or nothing when probes are compiled out
+    {
+        PROBE_SCOPE(probes, ExampleTxProbe);
+        delayMicroseconds(10);
+    }
+    printComparison(static_cast<uint32_t>(PROBES_ENABLED ? 1 : 0), probes.getStats(ExampleTxProbe).count);
+
+    probes.reset();
+    printComparison(static_cast<uint32_t>(0), probes.getStats(ExampleRxProbe).count);
+}
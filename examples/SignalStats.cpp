@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include "SignalStats.h"
+#include "Reserved.h"
+
+void signalStatsExample()
+{
+    SignalStats<4, 8> stats;
+    printComparison(true, stats.configure(BMSTemperatureId, 10));
+    printComparison(false, stats.add(VoltageInfoId, 400));
+
+    // Temperature climbs from 30.0 to 39.9 degrees
+    for (int i = 0; i < 100; i++)
+    {
+        stats.add(BMSTemperatureId, 30 + i * 0.1f);
+    }
+
+    const WelfordStats* session = stats.getCumulative(BMSTemperatureId);
+    printComparison(static_cast<uint32_t>(100), session->getCount());
+    printComparison(static_cast<int32_t>(3495), static_cast<int32_t>(lround(session->getMean() * 100)));
+    printComparison(static_cast<int32_t>(289), static_cast<int32_t>(lround(session->getStdDev() * 100)));
+
+    // The window only sees the last 8 samples
+    const WindowStats<8>* window = stats.getWindow(BMSTemperatureId);
+    printComparison(static_cast<uint32_t>(8), window->getCount());
+    printComparison(static_cast<int32_t>(392), static_cast<int32_t>(lround(window->getMin() * 10)));
+    printComparison(static_cast<int32_t>(399), static_cast<int32_t>(lround(window->getMax() * 10)));
+    printComparison(static_cast<int32_t>(3955), static_cast<int32_t>(lround(window->getMean() * 100)));
+}
+
+void signalStatsSnapshotExample()
+{
+    SignalStats<4, 8> stats;
+    stats.configure(CurrentInfoId, 10);
+    for (int i = 0; i < 50; i++)
+    {
+        stats.add(CurrentInfoId, i % 2 == 0 ? 120.0f : 80.0f);
+    }
+
+    CanFrame frames[2];
+    printComparison(true, stats.packSnapshot(CurrentInfoId, false, frames));
+    printComparison(false, stats.packSnapshot(VoltageInfoId, false, frames));
+
+    SignalStatsSnapshot snapshot;
+    SignalStats<>::unpackSnapshot(frames[0], snapshot);
+    printComparison(false, snapshot.complete());
+    SignalStats<>::unpackSnapshot(frames[1], snapshot);
+    printComparison(true, snapshot.complete());
+    printComparison(static_cast<uint32_t>(CurrentInfoId), static_cast<uint32_t>(snapshot.id));
+    printComparison(static_cast<int16_t>(800), snapshot.min);
+    printComparison(static_cast<int16_t>(1200), snapshot.max);
+    printComparison(static_cast<int16_t>(1000), snapshot.mean);
+    printComparison(static_cast<uint16_t>(200), snapshot.stdDev);
+    printComparison(static_cast<uint32_t>(50), snapshot.count);
+}
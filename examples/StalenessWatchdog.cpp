@@ -0,0 +1,64 @@
+#include <Arduino.h>
+#include "StalenessWatchdog.h"
+#include "VirtualClock.h"
+
+/** The last ID reported stale by the watchdog below */
+struct StalenessExampleState
+{
+    uint32_t id = INVALIDId;
+    uint32_t silentUs = 0;
+};
+
+void stalenessWatchdogExample()
+{
+    // Start close to the micros() wrap
+    VirtualClock clock(0xFFFFFFFFull - 20000);
+    StalenessExampleState state;
+    static StalenessWatchdog<16, 1000> watchdog(
+        [](const uint32_t id, const uint32_t silentUs, void* context) {
+            static_cast<StalenessExampleState*>(context)->id = id;
+            static_cast<StalenessExampleState*>(context)->silentUs = silentUs;
+        },
+        &state);
+
+    printComparison(true, watchdog.watch(Throttle1PositionId, 10000, clock.micros()));
+    printComparison(true, watchdog.watch(BrakePressureId, 10000, clock.micros()));
+    printComparison(false, watchdog.watch(INVALIDId, 10000, clock.micros()));
+
+    // Both IDs arrive every 5 ms for 100 ms, across the wrap
+    size_t expired = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        clock.advance(1000);
+        if (i % 5 == 0)
+        {
+            watchdog.feed(Throttle1PositionId, clock.micros());
+            watchdog.feed(BrakePressureId, clock.micros());
+        }
+        expired += watchdog.poll(clock.micros());
+    }
+    printComparison(static_cast<size_t>(0), expired);
+    printComparison(static_cast<uint32_t>(5000), watchdog.getStats(Throttle1PositionId)->maxGapUs);
+
+    // The brake pressure sensor goes quiet
+    for (int i = 0; i < 20; i++)
+    {
+        clock.advance(1000);
+        if (i % 5 == 0)
+        {
+            watchdog.feed(Throttle1PositionId, clock.micros());
+        }
+        expired += watchdog.poll(clock.micros());
+    }
+    printComparison(static_cast<size_t>(1), expired);
+    printComparison(static_cast<uint32_t>(BrakePressureId), state.id);
+    printComparison(true, state.silentUs >= 10000 && state.silentUs <= 12000);
+    printComparison(true, watchdog.isStale(BrakePressureId));
+    printComparison(false, watchdog.isStale(Throttle1PositionId));
+
+    // It comes back, and the outage shows up as the worst-case gap
+    watchdog.feed(BrakePressureId, clock.micros());
+    printComparison(false, watchdog.isStale(BrakePressureId));
+    printComparison(static_cast<uint32_t>(1), watchdog.getStats(BrakePressureId)->expiries);
+    printComparison(static_cast<uint32_t>(24000), watchdog.getStats(BrakePressureId)->maxGapUs);
+}
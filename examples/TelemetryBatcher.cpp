@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include "TelemetryBatcher.h"
+#include "VirtualClock.h"
+
+/** Serial stand-in that keeps the written batches, one per write */
+struct TelemetryCaptureSink
+{
+    uint8_t batches[8][64] = {};
+    size_t sizes[8] = {};
+    size_t count = 0;
+
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        if (count == 8)
+        {
+            return 0;
+        }
+        memcpy(batches[count], data, size);
+        sizes[count++] = size;
+        return size;
+    }
+};
+
+void telemetryBatcherExample()
+{
+    VirtualClock clock;
+    TelemetryCaptureSink sink;
+    TelemetryBatcher<TelemetryCaptureSink, 64> telemetry(sink, 2000);
+
+    // Three 8-byte frames fill a 64-byte full-speed USB packet, so ten frames take four writes instead of ten
+    CanFrame frame;
+    frame.id = CurrentInfoId;
+    frame.len = 8;
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        clock.advance(100);
+        frame.timestamp = clock.micros();
+        frame.buf[0] = i;
+        telemetry.append(frame, clock.micros());
+        telemetry.poll(clock.micros());
+    }
+    printComparison(static_cast<size_t>(3), sink.count);
+    printComparison(static_cast<size_t>(1), telemetry.getPendingCount());
+
+    // The last frame goes out once it has waited 2 ms
+    clock.advance(1999);
+    printComparison(static_cast<size_t>(0), telemetry.poll(clock.micros()));
+    clock.advance(1);
+    printComparison(true, telemetry.poll(clock.micros()) > 0);
+    printComparison(static_cast<uint32_t>(1), telemetry.getStats().deadlineFlushes);
+    printComparison(static_cast<uint32_t>(10), telemetry.getStats().frames);
+
+    // The receiver decodes every batch but the second, which was lost on the way
+    CobsDecoder<4, 64> decoder;
+    TelemetryBatchReader reader;
+    uint8_t lastMarker = 0;
+    uint32_t lastTimestamp = 0;
+    for (size_t i = 0; i < sink.count; i++)
+    {
+        if (i == 1)
+        {
+            continue;
+        }
+        decoder.feed(sink.batches[i], sink.sizes[i]);
+        decoder.getPackets().drain([&](const CobsPacket<64>& packet) {
+            reader.read(packet.data, packet.size, [&](const CanFrame& received) {
+                lastMarker = received.buf[0];
+                lastTimestamp = received.timestamp;
+            });
+        });
+    }
+    printComparison(static_cast<uint32_t>(3), reader.getBatchCount());
+    printComparison(static_cast<uint32_t>(7), reader.getFrameCount());
+    printComparison(static_cast<uint32_t>(1), reader.getLostCount());
+    printComparison(static_cast<uint8_t>(9), lastMarker);
+    printComparison(static_cast<uint32_t>(1000), lastTimestamp);
+}
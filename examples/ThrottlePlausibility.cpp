@@ -0,0 +1,82 @@
+#include <Arduino.h>
+#include "ThrottlePlausibility.h"
+#include "VirtualClock.h"
+
+void throttlePlausibilityExample()
+{
+    VirtualClock clock;
+    FaultEngine faults;
+    ThrottlePlausibility throttle(faults);
+
+    // Throttle 2 reads backwards
+    printComparison(true, throttle.setCalibration(0, 400, 3600));
+    printComparison(true, throttle.setCalibration(1, 3700, 500));
+    printComparison(false, throttle.setCalibration(1, 500, 500));
+
+    // Half pressed on both sensors
+    throttle.update(0, 2000, clock.micros());
+    throttle.update(1, 2100, clock.micros());
+    printComparison(static_cast<int32_t>(5000), throttle.getSensorTravel(0));
+    printComparison(static_cast<int32_t>(5000), throttle.getSensorTravel(1));
+    printComparison(static_cast<int32_t>(5000), throttle.getTravel());
+
+    // Throttle 2 drifts 15 % away; tolerated for 100 ms, then a mismatch fault
+    for (int i = 0; i <= 100; i++)
+    {
+        clock.advanceMillis(1);
+        throttle.update(0, 2000, clock.micros());
+        throttle.update(1, 1620, clock.micros());
+    }
+    printComparison(static_cast<uint8_t>(0), faults.getActiveMask());
+    clock.advanceMillis(1);
+    throttle.update(0, 2000, clock.micros());
+    throttle.update(1, 1620, clock.micros());
+    printComparison(faultBit(ThrottleMismatchId), faults.getActiveMask());
+    printComparison(static_cast<int32_t>(0), throttle.getTravel());
+
+    // The sensors agree again: the fault goes inactive but stays latched
+    clock.advanceMillis(1);
+    throttle.update(1, 2100, clock.micros());
+    printComparison(static_cast<uint8_t>(0), faults.getActiveMask());
+    printComparison(faultBit(ThrottleMismatchId), faults.getLatchedMask());
+
+    // Throttle 1 wire breaks and reads 0
+    CanFrame frame;
+    Throttle1PositionMessage broken;
+    for (int i = 0; i < 102; i++)
+    {
+        clock.advanceMillis(1);
+        pack(broken, frame);
+        throttle.handleFrame(frame, clock.micros());
+    }
+    printComparison(true, (faults.getActiveMask() & faultBit(Throttle1ZeroId)) != 0);
+}
+
+void throttleDashCalibrationExample()
+{
+    FaultEngine faults;
+    ThrottlePlausibility throttle(faults);
+    printComparison(true, throttle.setCalibration(0, 400, 3600));
+    printComparison(true, throttle.setCalibration(1, 3700, 500));
+
+    // The Dash recalibrates throttle 1's rest reading; the inverted throttle 2 keeps its own calibration
+    ThrottleMinMessage rest;
+    rest.raw = 800;
+    CanFrame frame;
+    pack(rest, frame);
+    printComparison(true, throttle.handleFrame(frame, 0));
+    throttle.update(0, 2200, 0);
+    throttle.update(1, 2100, 0);
+    printComparison(static_cast<int32_t>(5000), throttle.getSensorTravel(0));
+    printComparison(static_cast<int32_t>(5000), throttle.getSensorTravel(1));
+
+    // Still no mismatch or range fault long after the calibration frame
+    throttle.update(0, 2200, 200000);
+    throttle.update(1, 2100, 200000);
+    printComparison(static_cast<uint8_t>(0), faults.getActiveMask());
+    printComparison(static_cast<int32_t>(5000), throttle.getTravel());
+
+    // Sensors that share throttle 1's range can opt in
+    printComparison(true, throttle.setFollowsDashCalibration(1, true));
+    printComparison(false, throttle.setFollowsDashCalibration(2, true));
+}
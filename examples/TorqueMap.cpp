@@ -0,0 +1,39 @@
+#include <Arduino.h>
+#include "TorqueMap.h"
+#include "Reserved.h"
+
+void torqueMapExample()
+{
+    // Pedal reads 400 at rest and 3600 fully pressed
+    TorqueMap torqueMap(400, 3600);
+
+    // Tables are generated at compile time
+    static_assert(TorqueMap::TABLES[FullId].points[TORQUE_TABLE_SEGMENTS] == TORQUE_FULL_SCALE, "Full mode reaches full torque");
+
+    torqueMap.setMode(FullId);
+    printComparison(static_cast<uint16_t>(0), torqueMap.torque(400));
+    printComparison(static_cast<uint16_t>(0), torqueMap.torque(100)); // below calibration is clamped
+    const uint16_t halfTorque = torqueMap.torque(2000);
+    printComparison(true, halfTorque > 16000 && halfTorque < 16800);
+
+    // Limp mode caps torque at 30%
+    torqueMap.setMode(LimpId);
+    const uint16_t limpTorque = torqueMap.torque(3600);
+    printComparison(true, limpTorque > 9700 && limpTorque <= 9830);
+}
+
+void torqueMapCalibrationExample()
+{
+    TorqueMap torqueMap(400, 3600);
+    torqueMap.setMode(FullId);
+
+    // A ThrottleMaxId frame moves the top of the pedal travel without rebuilding any table
+    BufferPacker<sizeof(uint16_t)> packer;
+    packer.pack(static_cast<uint16_t>(2000));
+    CanFrame frame;
+    frame.pack(ThrottleMaxId, packer);
+
+    printComparison(true, torqueMap.applyCalibrationFrame(frame));
+    printComparison(static_cast<uint16_t>(0xFFFF), torqueMap.normalize(2000));
+    printComparison(true, torqueMap.torque(2000) > 32700);
+}
@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include "TxScheduler.h"
+#include "FrameRing.h"
+#include "VirtualClock.h"
+#include "Reserved.h"
+
+/** Pack callback - writes a dummy sensor reading straight into the TX mailbox */
+bool packSensorExample(const uint32_t id, CanFrame& mailbox, void* context)
+{
+    auto* packCount = static_cast<uint32_t*>(context);
+    (*packCount)++;
+
+    BufferPacker<sizeof(uint16_t)> packer;
+    packer.pack(static_cast<uint16_t>(id));
+    return mailbox.pack(id, packer);
+}
+
+void txSchedulerExample()
+{
+    // Per-ID transmit rates - three IDs at the same rate would bunch onto the same millisecond without staggering
+    constexpr TxRate RATES[] = {
+        {Throttle1PositionId, 10},
+        {Throttle2PositionId, 10},
+        {BrakePressureId, 10},
+        {SteeringWheelAngleId, 20},
+    };
+
+    uint32_t packCount = 0;
+    TxScheduler<4> scheduler(RATES, packSensorExample, &packCount);
+    FrameRing<64> txRing;
+
+    // Deterministic virtual clock instead of millis()
+    VirtualClock clock;
+    scheduler.begin(clock.millis());
+
+    // Run 100 ms of loop() iterations, one per millisecond
+    for (int i = 0; i < 100; i++)
+    {
+        scheduler.tick(clock.millis(), txRing);
+        clock.advanceMillis(1);
+    }
+
+    // 3 IDs * 10 sends + 1 ID * 5 sends
+    printComparison(static_cast<uint32_t>(35), packCount);
+    printComparison(static_cast<size_t>(35), txRing.size());
+
+    // Same-rate IDs were given different phase offsets
+    const bool staggered = scheduler.getOffset(Throttle1PositionId) != scheduler.getOffset(Throttle2PositionId) &&
+        scheduler.getOffset(Throttle2PositionId) != scheduler.getOffset(BrakePressureId) &&
+        scheduler.getOffset(Throttle1PositionId) != scheduler.getOffset(BrakePressureId);
+    printComparison(true, staggered);
+}
+
+void txSchedulerStallExample()
+{
+    uint32_t packCount = 0;
+    TxScheduler<1> scheduler(packSensorExample, &packCount);
+    scheduler.add(Throttle1PositionId, 5);
+    FrameRing<64> txRing;
+    scheduler.begin(0);
+
+    scheduler.tick(0, txRing);
+    printComparison(static_cast<size_t>(1), txRing.size());
+
+    // A 1 s stall fires the ID once, late, instead of catching up with a burst of 200 frames
+    scheduler.tick(1000, txRing);
+    printComparison(static_cast<size_t>(2), txRing.size());
+
+    // Deadlines 5 to 1000 were due; one fired and the other 199 were skipped
+    printComparison(static_cast<uint32_t>(199), scheduler.getOverrunCount());
+
+    // The schedule keeps its phase: the next transmission is at 1005
+    scheduler.tick(1004, txRing);
+    printComparison(static_cast<size_t>(2), txRing.size());
+    scheduler.tick(1005, txRing);
+    printComparison(static_cast<size_t>(3), txRing.size());
+    printComparison(static_cast<uint32_t>(199), scheduler.getOverrunCount());
+}
@@ -0,0 +1,69 @@
+#include <Arduino.h>
+#include "VirtualCanBus.h"
+#include "VirtualClock.h"
+#include "Reserved.h"
+
+void virtualCanBusExample()
+{
+    VirtualClock clock;
+    VirtualCanBus<> bus(clock);
+
+    VirtualCanBus<>::Node* pedalBox = bus.attach();
+    VirtualCanBus<>::Node* vcu = bus.attach();
+    VirtualCanBus<>::Node* dash = bus.attach();
+
+    // Two nodes want the bus at the same time - the lower ID wins arbitration
+    CanFrame brake;
+    brake.id = BrakePressureId;
+    brake.len = 2;
+    CanFrame status;
+    status.id = DriveStateId;
+    status.len = 1;
+
+    dash->write(status);
+    pedalBox->write(brake);
+    bus.runUntilIdle();
+
+    CanFrame received;
+    vcu->read(received);
+    printComparison(static_cast<uint32_t>(BrakePressureId), received.id);
+    vcu->read(received);
+    printComparison(static_cast<uint32_t>(DriveStateId), received.id);
+    printComparison(static_cast<uint32_t>(1), dash->getStats().arbitrationLosses);
+
+    // Senders don't receive their own frames - the pedal box only sees the dash's frame
+    pedalBox->read(received);
+    printComparison(static_cast<uint32_t>(DriveStateId), received.id);
+    printComparison(0, pedalBox->read(received));
+}
+
+void virtualCanBusThroughputExample()
+{
+    VirtualClock clock;
+    VirtualCanBus<2, 16> bus(clock);
+    VirtualCanBus<2, 16>::Node* sender = bus.attach();
+    VirtualCanBus<2, 16>::Node* receiver = bus.attach();
+
+    // Send 8-byte frames back to back for 10 ms of simulated time
+    CanFrame frame;
+    frame.id = CurrentInfoId;
+    frame.len = 8;
+    size_t received = 0;
+    while (clock.now() < 10000)
+    {
+        while (sender->getPendingCount() < 4)
+        {
+            sender->write(frame);
+        }
+        bus.step();
+        CanFrame rx;
+        while (receiver->read(rx))
+        {
+            received++;
+        }
+    }
+
+    // An 8-byte frame is at most 135 bits, so 1 Mbit/s fits at least 74 frames in 10 ms
+    printComparison(true, received >= 74);
+    printComparison(true, bus.getUtilizationPermille(clock.now()) > 990);
+}
@@ -1,5 +1,28 @@
 #include <Arduino.h>
 #include "./BufferPacker.cpp"
+#include "./FrameRing.cpp"
+#include "./TxScheduler.cpp"
+#include "./ChangeFilter.cpp"
+#include "./MuxCodec.cpp"
+#include "./BusLoad.cpp"
+#include "./FaultEngine.cpp"
+#include "./TorqueMap.cpp"
+#include "./HealthCheck.cpp"
+#include "./ParameterClient.cpp"
+#include "./VirtualCanBus.cpp"
+#include "./FrameLog.cpp"
+#include "./ColumnFile.cpp"
+#include "./LogSink.cpp"
+#include "./Downsampler.cpp"
+#include "./SignalStats.cpp"
+#include "./MessageCodecs.cpp"
+#include "./MessageBus.cpp"
+#include "./StalenessWatchdog.cpp"
+#include "./PedalBox.cpp"
+#include "./ThrottlePlausibility.cpp"
+#include "./Cobs.cpp"
+#include "./TelemetryBatcher.cpp"
+#include "./Probe.cpp"
 
 void setup() {
     Serial.begin(115200);
@@ -27,5 +50,110 @@ void loop() {
     Serial.println("Buffer Protection Example: ");
     bufferProtectionExample();
     Serial.println();
+    Serial.println("Frame Ring Example: ");
+    frameRingExample();
+    Serial.println();
+    Serial.println("Frame Ring Overflow Example: ");
+    frameRingOverflowExample();
+    Serial.println();
+    Serial.println("Transmit Scheduler Example: ");
+    txSchedulerExample();
+    Serial.println();
+    Serial.println("Transmit Scheduler Stall Example: ");
+    txSchedulerStallExample();
+    Serial.println();
+    Serial.println("Send-on-Change Filter Example: ");
+    changeFilterExample();
+    Serial.println();
+    Serial.println("Send-on-Change Whole Frame Example: ");
+    changeFilterWholeFrameExample();
+    Serial.println();
+    Serial.println("Multiplexed Codec Example: ");
+    muxCodecExample();
+    Serial.println();
+    Serial.println("Multiplexed Codec Batch Example: ");
+    muxCodecBatchExample();
+    Serial.println();
+    Serial.println("Frame Bit Cost Example: ");
+    busLoadFrameBitsExample();
+    Serial.println();
+    Serial.println("Bus Load Monitor Example: ");
+    busLoadMonitorExample();
+    Serial.println();
+    Serial.println("Fault Engine Example: ");
+    faultEngineExample();
+    Serial.println();
+    Serial.println("Fault Engine Frame Example: ");
+    faultEngineFrameExample();
+    Serial.println();
+    Serial.println("Torque Map Example: ");
+    torqueMapExample();
+    Serial.println();
+    Serial.println("Torque Map Calibration Example: ");
+    torqueMapCalibrationExample();
+    Serial.println();
+    Serial.println("Health Check Latency Example: ");
+    healthCheckExample();
+    Serial.println();
+    Serial.println("Pipelined Parameter Client Example: ");
+    parameterClientExample();
+    Serial.println();
+    Serial.println("Virtual CAN Bus Example: ");
+    virtualCanBusExample();
+    Serial.println();
+    Serial.println("Virtual CAN Bus Throughput Example: ");
+    virtualCanBusThroughputExample();
+    Serial.println();
+    Serial.println("Frame Log Example: ");
+    frameLogExample();
+    Serial.println();
+    Serial.println("Column File Example: ");
+    columnFileExample();
+    Serial.println();
+    Serial.println("Log Sink Example: ");
+    logSinkExample();
+    Serial.println();
+    Serial.println("Log Sink Starved Example: ");
+    logSinkStarvedExample();
+    Serial.println();
+    Serial.println("Downsampler Bucket Example: ");
+    downsamplerBucketExample();
+    Serial.println();
+    Serial.println("Downsampler FIR Example: ");
+    downsamplerFirExample();
+    Serial.println();
+    Serial.println("Signal Stats Example: ");
+    signalStatsExample();
+    Serial.println();
+    Serial.println("Signal Stats Snapshot Example: ");
+    signalStatsSnapshotExample();
+    Serial.println();
+    Serial.println("Message Codecs Example: ");
+    messageCodecsExample();
+    Serial.println();
+    Serial.println("Message Bus Example: ");
+    messageBusExample();
+    Serial.println();
+    Serial.println("Staleness Watchdog Example: ");
+    stalenessWatchdogExample();
+    Serial.println();
+    Serial.println("Pedal Box Example: ");
+    pedalBoxExample();
+    Serial.println();
+    Serial.println("Throttle Plausibility Example: ");
+    throttlePlausibilityExample();
+    Serial.println();
+    Serial.println("Throttle Dash Calibration Example: ");
+    throttleDashCalibrationExample();
+    Serial.println();
+    Serial.println("COBS Example: ");
+    cobsExample();
+    Serial.println();
+    Serial.println("Telemetry Batcher Example: ");
+    telemetryBatcherExample();
+    Serial.println();
+    Serial.println("Probe Example: ");
+    probeExample();
+    Serial.println();
     delay(10000);
 }
@@ -242,6 +242,12 @@ public:
         return m_DataSize;
     }
 
+    /** @return the number of bytes packed (or unpacked) so far */
+    [[nodiscard]] size_t getPackedSize() const
+    {
+        return m_Offset;
+    }
+
     /**
      * <b>Reset the internal buffer to 0 and enter 'PACK' Mode</b>
      *
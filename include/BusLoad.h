@@ -0,0 +1,303 @@
+#ifndef BUSLOAD_H
+#define BUSLOAD_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/**
+ * <b>Worst-case on-wire length of a classic CAN data frame, in bits.</b>
+ *
+ * Counts SOF through the 3-bit interframe space, plus the maximum number of stuff bits the stuffed region
+ * (SOF through CRC) can need.
+ *
+ * @param len the DLC of the frame; clamped to 8
+ * @param extended whether the frame uses a 29-bit ID
+ * @return The worst-case number of bit times the frame occupies the bus for
+ */
+constexpr uint32_t worstCaseFrameBits(const uint8_t len, const bool extended)
+{
+    const uint32_t dataBits = 8u * (len > CAN_MAX_DLC ? CAN_MAX_DLC : len);
+    const uint32_t stuffedBits = (extended ? 54u : 34u) + dataBits;
+    // CRC delimiter, ACK slot + delimiter, EOF and interframe space are never stuffed
+    return stuffedBits + 13u + (stuffedBits - 1u) / 4u;
+}
+
+/**
+ * <b>Exact on-wire length of a classic CAN data frame, in bits.</b>
+ *
+ * Builds the frame's bit sequence (including the CRC-15) and counts the stuff bits it actually needs, which is what
+ * the frame really costs on the bus. More expensive than worstCaseFrameBits(), but still bounded at under 140 bits.
+ *
+ * @param frame the frame to measure
+ * @return The number of bit times the frame occupies the bus for
+ */
+inline uint32_t exactFrameBits(const CanFrame& frame)
+{
+    const uint8_t len = frame.len > CAN_MAX_DLC ? CAN_MAX_DLC : frame.len;
+    uint8_t bits[54 + 8 * CAN_MAX_DLC + 15];
+    size_t count = 0;
+    auto put = [&bits, &count](const uint32_t value, const uint8_t width)
+    {
+        for (int bit = width - 1; bit >= 0; bit--)
+        {
+            bits[count++] = (value >> bit) & 1u;
+        }
+    };
+
+    put(0, 1); // SOF
+    if (frame.extended)
+    {
+        put(frame.id >> 18, 11);
+        put(1, 1); // SRR
+        put(1, 1); // IDE
+        put(frame.id, 18);
+        put(0, 1); // RTR
+        put(0, 2); // r1, r0
+    } else
+    {
+        put(frame.id, 11);
+        put(0, 1); // RTR
+        put(0, 1); // IDE
+        put(0, 1); // r0
+    }
+    put(frame.len, 4);
+    for (size_t i = 0; i < len; i++)
+    {
+        put(frame.buf[i], 8);
+    }
+
+    uint16_t crc = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const bool feedback = bits[i] ^ ((crc >> 14) & 1u);
+        crc = static_cast<uint16_t>((crc << 1) & 0x7FFF);
+        if (feedback)
+        {
+            crc ^= 0x4599;
+        }
+    }
+    put(crc, 15);
+
+    // A stuff bit follows every run of five equal bits and itself starts the next run
+    uint32_t stuffBits = 0;
+    uint8_t runLength = 1;
+    uint8_t previous = bits[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        if (bits[i] == previous)
+        {
+            runLength++;
+        } else
+        {
+            previous = bits[i];
+            runLength = 1;
+        }
+        if (runLength == 5)
+        {
+            stuffBits++;
+            previous = !previous;
+            runLength = 1;
+        }
+    }
+    return static_cast<uint32_t>(count) + stuffBits + 13u;
+}
+
+/**
+ * <b>Per-ID bus load accounting over a sliding window.</b>
+ *
+ * Every recorded frame adds its on-wire bit cost to the current bucket of its ID. The window is made of WINDOW_BUCKETS
+ * buckets of bucketMs each; as time moves on the oldest bucket is dropped, so the per-ID totals always cover the most
+ * recent WINDOW_BUCKETS * bucketMs milliseconds. Reading a total is O(1).
+ *
+ * IDs that aren't in ReservedIDs are all accounted to a single "other" entry.
+ *
+ * <code>
+ * BusLoadMonitor<10> busLoad(100);   // 1 second window in 100 ms buckets
+ * busLoad.record(frame, millis());
+ * busLoad.exportTo(Serial);
+ * </code>
+ * @tparam WINDOW_BUCKETS the number of buckets in the sliding window; defaults to 10
+ */
+template <size_t WINDOW_BUCKETS = 10> class BusLoadMonitor
+{
+    static_assert(WINDOW_BUCKETS > 0, "BusLoadMonitor needs at least one bucket");
+
+public:
+    /** Number of accounted entries: every reserved ID plus one for unreserved IDs. */
+    static constexpr size_t ENTRY_COUNT = RESERVED_ID_COUNT + 1;
+
+    /**
+     * @param bucketMs the length of one bucket in milliseconds
+     * @param bitRate the bus bit rate in bits per second; defaults to 1 Mbit/s
+     * @param exact whether to count each frame's actual stuff bits (true) or the worst case (false)
+     */
+    explicit BusLoadMonitor(const uint32_t bucketMs, const uint32_t bitRate = 1000000, const bool exact = true)
+        : m_BucketMs(bucketMs > 0 ? bucketMs : 1), m_BitRate(bitRate), m_Exact(exact)
+    {
+    }
+
+    /**
+     * <b>Account a transmitted or received frame.</b>
+     *
+     * @param frame the frame seen on the bus
+     * @param nowMs the current time in milliseconds; must not go backwards
+     */
+    void record(const CanFrame& frame, const uint32_t nowMs)
+    {
+        advance(nowMs);
+        const uint32_t bits = m_Exact ? exactFrameBits(frame) : worstCaseFrameBits(frame.len, frame.extended);
+        const size_t entry = reservedIdIndex(frame.id);
+        m_Buckets[m_Bucket][entry] += bits;
+        m_WindowBits[entry] += bits;
+        m_WindowFrames[entry]++;
+        m_FrameBuckets[m_Bucket][entry]++;
+        m_TotalWindowBits += bits;
+    }
+
+    /**
+     * <b>Move the window forward to nowMs without recording anything.</b>
+     *
+     * record() already does this; call it before reading totals if the bus may have gone quiet.
+     */
+    void advance(const uint32_t nowMs)
+    {
+        if (!m_Started)
+        {
+            m_BucketStart = nowMs;
+            m_Started = true;
+            return;
+        }
+        uint32_t elapsed = (nowMs - m_BucketStart) / m_BucketMs;
+        if (elapsed == 0)
+        {
+            return;
+        }
+        m_BucketStart += elapsed * m_BucketMs;
+        if (elapsed > WINDOW_BUCKETS)
+        {
+            elapsed = WINDOW_BUCKETS;
+        }
+        for (uint32_t i = 0; i < elapsed; i++)
+        {
+            m_Bucket = (m_Bucket + 1) % WINDOW_BUCKETS;
+            for (size_t entry = 0; entry < ENTRY_COUNT; entry++)
+            {
+                m_WindowBits[entry] -= m_Buckets[m_Bucket][entry];
+                m_WindowFrames[entry] -= m_FrameBuckets[m_Bucket][entry];
+                m_TotalWindowBits -= m_Buckets[m_Bucket][entry];
+                m_Buckets[m_Bucket][entry] = 0;
+                m_FrameBuckets[m_Bucket][entry] = 0;
+            }
+        }
+    }
+
+    /** @return the bit times used by id within the window */
+    [[nodiscard]] uint32_t getWindowBits(const uint32_t id) const
+    {
+        return m_WindowBits[reservedIdIndex(id)];
+    }
+
+    /** @return the number of frames with id within the window */
+    [[nodiscard]] uint32_t getWindowFrames(const uint32_t id) const
+    {
+        return m_WindowFrames[reservedIdIndex(id)];
+    }
+
+    /** @return the share of the bus used by id within the window, in tenths of a percent */
+    [[nodiscard]] uint32_t getUtilizationPermille(const uint32_t id) const
+    {
+        return toPermille(getWindowBits(id));
+    }
+
+    /** @return the share of the bus used by all IDs within the window, in tenths of a percent */
+    [[nodiscard]] uint32_t getTotalUtilizationPermille() const
+    {
+        return toPermille(m_TotalWindowBits);
+    }
+
+    /** @return the length of the window in milliseconds */
+    [[nodiscard]] uint32_t getWindowMs() const
+    {
+        return m_BucketMs * static_cast<uint32_t>(WINDOW_BUCKETS);
+    }
+
+    /**
+     * <b>Write a compact binary snapshot of the window.</b>
+     *
+     * The snapshot is a 10-byte header (uint16_t entry count, uint32_t window length in ms, uint32_t bit rate)
+     * followed by one 10-byte record per ID that used the bus (uint32_t ID, uint32_t bits, uint16_t frames),
+     * all packed with BufferPacker. Unreserved IDs are reported as INVALIDId.
+     *
+     * @tparam WRITER any type with write(const uint8_t*, size_t), like Arduino's Serial
+     * @param out the destination of the snapshot
+     * @return The number of records written
+     */
+    template <typename WRITER> size_t exportTo(WRITER& out) const
+    {
+        uint16_t records = 0;
+        for (size_t entry = 0; entry < ENTRY_COUNT; entry++)
+        {
+            records += m_WindowBits[entry] != 0;
+        }
+
+        uint8_t header[sizeof(uint16_t) + 2 * sizeof(uint32_t)];
+        BufferPacker<sizeof(header)> headerPacker;
+        headerPacker.pack(records);
+        headerPacker.pack(getWindowMs());
+        headerPacker.pack(m_BitRate);
+        headerPacker.deepCopyTo(header);
+        out.write(header, sizeof(header));
+
+        for (size_t entry = 0; entry < ENTRY_COUNT; entry++)
+        {
+            if (m_WindowBits[entry] == 0)
+            {
+                continue;
+            }
+            const uint16_t frames = m_WindowFrames[entry] > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(m_WindowFrames[entry]);
+            uint8_t record[2 * sizeof(uint32_t) + sizeof(uint16_t)];
+            BufferPacker<sizeof(record)> recordPacker;
+            recordPacker.pack(static_cast<uint32_t>(reservedIdAt(entry)));
+            recordPacker.pack(m_WindowBits[entry]);
+            recordPacker.pack(frames);
+            recordPacker.deepCopyTo(record);
+            out.write(record, sizeof(record));
+        }
+        return records;
+    }
+
+private:
+    uint32_t toPermille(const uint32_t bits) const
+    {
+        const uint64_t capacity = static_cast<uint64_t>(m_BitRate) * getWindowMs() / 1000;
+        return capacity == 0 ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(bits) * 1000 / capacity);
+    }
+
+    /** Length of one bucket in milliseconds. */
+    uint32_t m_BucketMs;
+    /** Bus bit rate in bits per second. */
+    uint32_t m_BitRate;
+    /** Whether to count actual stuff bits instead of the worst case. */
+    bool m_Exact;
+    /** Whether the first timestamp has been seen. */
+    bool m_Started = false;
+    /** Start time, in milliseconds, of the current bucket. */
+    uint32_t m_BucketStart = 0;
+    /** Index of the current bucket. */
+    size_t m_Bucket = 0;
+    /** Bits per bucket per entry. */
+    uint32_t m_Buckets[WINDOW_BUCKETS][ENTRY_COUNT] = {};
+    /** Frames per bucket per entry. */
+    uint32_t m_FrameBuckets[WINDOW_BUCKETS][ENTRY_COUNT] = {};
+    /** Running per-entry bit totals over the whole window. */
+    uint32_t m_WindowBits[ENTRY_COUNT] = {};
+    /** Running per-entry frame totals over the whole window. */
+    uint32_t m_WindowFrames[ENTRY_COUNT] = {};
+    /** Running bit total of all entries over the whole window. */
+    uint32_t m_TotalWindowBits = 0;
+};
+
+#endif //BUSLOAD_H
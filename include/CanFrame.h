@@ -0,0 +1,66 @@
+#ifndef CANFRAME_H
+#define CANFRAME_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "BufferPacker.h"
+#include "Reserved.h"
+
+/** Maximum number of data bytes in a classic CAN frame. */
+constexpr size_t CAN_MAX_DLC = 8;
+
+/**
+ * <b>Fixed-size CAN frame shared by the drivers, queues and codecs in this library.</b>
+ *
+ * The field names mirror the hardware driver's message type (id, len, buf), so code written against a CanFrame
+ * ports directly to the driver and back.
+ */
+struct CanFrame
+{
+    /** Arbitration ID, usually one of the ReservedIDs. */
+    uint32_t id = INVALIDId;
+    /** Capture time in microseconds, filled in by whoever received or produced the frame. */
+    uint32_t timestamp = 0;
+    /** Number of valid bytes in buf (the DLC). */
+    uint8_t len = 0;
+    /** Whether the frame uses a 29-bit extended ID rather than an 11-bit standard ID. */
+    bool extended = false;
+    /** Payload bytes; only the first len bytes are meaningful. */
+    uint8_t buf[CAN_MAX_DLC] = {};
+
+    /**
+     * <b>Copy the packed contents of a BufferPacker into this frame.</b>
+     *
+     * The frame's DLC is the number of bytes packed so far, so a packer that is only partly filled gives a short frame.
+     *
+     * @tparam SIZE the size of the packer's internal buffer; must fit in a single frame
+     * @param frameId the arbitration ID to give the frame
+     * @param packer the packer holding the payload
+     * @return false if the packer has failed, true otherwise
+     */
+    template <size_t SIZE> bool pack(const uint32_t frameId, BufferPacker<SIZE>& packer)
+    {
+        static_assert(SIZE <= CAN_MAX_DLC, "BufferPacker is larger than a CAN frame payload");
+        packer.deepCopyTo(buf);
+        if (!packer)
+        {
+            return false;
+        }
+        id = frameId;
+        len = static_cast<uint8_t>(packer.getPackedSize());
+        return true;
+    }
+
+    /**
+     * <b>Create a BufferPacker in 'UNPACK' mode over a copy of this frame's payload.</b>
+     *
+     * @return An unpacker holding the first len bytes of buf
+     */
+    [[nodiscard]] BufferPacker<CAN_MAX_DLC> unpacker() const
+    {
+        return BufferPacker<CAN_MAX_DLC>(buf, len);
+    }
+};
+
+#endif //CANFRAME_H
@@ -0,0 +1,226 @@
+#ifndef CHANGEFILTER_H
+#define CHANGEFILTER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "CanFrame.h"
+
+/**
+ * <b>Send-on-change filter for a single transmitted signal.</b>
+ *
+ * The filter keeps a copy of the last payload that was actually sent and compares each newly packed frame against it:
+ *
+ * - with no fields configured, any byte difference (or a DLC change) counts as a change
+ * - with fields configured via addField(), only those fields are compared, and a field only counts as changed once it
+ *   has moved further than its deadband from the last <i>sent</i> value, so slow drift is still reported eventually;
+ *   bytes outside the configured fields are ignored
+ *
+ * Regardless of the payload, a frame is always let through once maxSilenceMs has passed since the last send, so
+ * receivers can still tell a quiet signal from a dead node.
+ *
+ * <code>
+ * ChangeFilter<2> bmsFilter(1000);            // at least once a second
+ * bmsFilter.addField<uint8_t>(0, 1);          // percentage, ignore +-1
+ * bmsFilter.addField<float>(1, 0.5f);         // temperature, ignore +-0.5
+ * if (bmsFilter.shouldSend(frame, millis())) { can.write(frame); }
+ * </code>
+ * @tparam MAX_FIELDS the maximum number of fields with individual deadbands; defaults to 4.
+ */
+template <size_t MAX_FIELDS = 4> class ChangeFilter
+{
+public:
+    /** @param maxSilenceMs the longest time, in milliseconds, a frame may be suppressed for */
+    explicit ChangeFilter(const uint32_t maxSilenceMs) : m_MaxSilenceMs(maxSilenceMs)
+    {
+    }
+
+    /**
+     * <b>Compare a field of the payload against a deadband instead of comparing raw bytes.</b>
+     *
+     * This method can return false without adding the field if either:
+     * - MAX_FIELDS fields have already been added
+     * - T is not one of the supported types (8, 16 or 32-bit integers, or float)
+     * - the field does not fit inside a CAN frame
+     *
+     * @tparam T the type the field was packed as
+     * @param offset the byte offset of the field in the payload
+     * @param deadband the largest change that is still considered "unchanged"
+     * @return true if the field was added, false otherwise
+     */
+    template <typename T> bool addField(const size_t offset, const T deadband)
+    {
+        const FieldType type = fieldTypeOf<T>();
+        if (m_FieldCount >= MAX_FIELDS || type == FieldType::Unsupported || offset + sizeof(T) > CAN_MAX_DLC)
+        {
+            return false;
+        }
+        Field& field = m_Fields[m_FieldCount++];
+        field.offset = static_cast<uint8_t>(offset);
+        field.size = static_cast<uint8_t>(sizeof(T));
+        field.type = type;
+        if (type == FieldType::F32)
+        {
+            field.floatDeadband = static_cast<float>(deadband);
+        } else
+        {
+            field.intDeadband = static_cast<int64_t>(deadband);
+        }
+        return true;
+    }
+
+    /**
+     * <b>Decide whether a newly packed frame should be transmitted.</b>
+     *
+     * When this returns true the frame becomes the new reference payload for later comparisons.
+     *
+     * @param frame the newly packed frame
+     * @param nowMs the current time in milliseconds
+     * @return true if the frame changed meaningfully or the silence interval ran out, false to suppress it
+     */
+    bool shouldSend(const CanFrame& frame, const uint32_t nowMs)
+    {
+        const bool silenceExpired = nowMs - m_LastSentMs >= m_MaxSilenceMs;
+        if (!m_HasSent || silenceExpired || hasChanged(frame))
+        {
+            memcpy(m_LastSent, frame.buf, CAN_MAX_DLC);
+            m_LastLen = frame.len;
+            m_LastSentMs = nowMs;
+            m_HasSent = true;
+            m_SentCount++;
+            return true;
+        }
+        m_SuppressedCount++;
+        return false;
+    }
+
+    /** <b>Force the next call of shouldSend() to let its frame through.</b> */
+    void forceNext()
+    {
+        m_HasSent = false;
+    }
+
+    /** @return the number of frames shouldSend() let through */
+    [[nodiscard]] uint32_t getSentCount() const
+    {
+        return m_SentCount;
+    }
+
+    /** @return the number of frames shouldSend() suppressed */
+    [[nodiscard]] uint32_t getSuppressedCount() const
+    {
+        return m_SuppressedCount;
+    }
+
+private:
+    /** Field encodings the filter knows how to compare. */
+    enum class FieldType : uint8_t
+    {
+        U8, I8, U16, I16, U32, I32, F32, Unsupported,
+    };
+
+    /** A payload field with its own deadband. */
+    struct Field
+    {
+        uint8_t offset;
+        uint8_t size;
+        FieldType type;
+        int64_t intDeadband;
+        float floatDeadband;
+    };
+
+    template <typename T> static constexpr FieldType fieldTypeOf()
+    {
+        if constexpr (std::is_same_v<T, uint8_t>) return FieldType::U8;
+        else if constexpr (std::is_same_v<T, int8_t>) return FieldType::I8;
+        else if constexpr (std::is_same_v<T, uint16_t>) return FieldType::U16;
+        else if constexpr (std::is_same_v<T, int16_t>) return FieldType::I16;
+        else if constexpr (std::is_same_v<T, uint32_t>) return FieldType::U32;
+        else if constexpr (std::is_same_v<T, int32_t>) return FieldType::I32;
+        else if constexpr (std::is_same_v<T, float>) return FieldType::F32;
+        else return FieldType::Unsupported;
+    }
+
+    template <typename T> static T read(const uint8_t* buffer, const size_t offset)
+    {
+        T value;
+        memcpy(&value, &buffer[offset], sizeof(T));
+        return value;
+    }
+
+    /** @return the integer value of an integer field */
+    static int64_t readInt(const uint8_t* buffer, const Field& field)
+    {
+        switch (field.type)
+        {
+            case FieldType::U8: return read<uint8_t>(buffer, field.offset);
+            case FieldType::I8: return read<int8_t>(buffer, field.offset);
+            case FieldType::U16: return read<uint16_t>(buffer, field.offset);
+            case FieldType::I16: return read<int16_t>(buffer, field.offset);
+            case FieldType::U32: return read<uint32_t>(buffer, field.offset);
+            case FieldType::I32: return read<int32_t>(buffer, field.offset);
+            default: return 0;
+        }
+    }
+
+    /** @return true if frame differs meaningfully from the last sent payload */
+    bool hasChanged(const CanFrame& frame) const
+    {
+        if (frame.len != m_LastLen)
+        {
+            return true;
+        }
+        if (m_FieldCount == 0)
+        {
+            return memcmp(frame.buf, m_LastSent, frame.len) != 0;
+        }
+        for (size_t i = 0; i < m_FieldCount; i++)
+        {
+            const Field& field = m_Fields[i];
+            if (field.offset + field.size > frame.len)
+            {
+                // Field isn't present in this payload
+                continue;
+            }
+            if (field.type == FieldType::F32)
+            {
+                const float delta = read<float>(frame.buf, field.offset) - read<float>(m_LastSent, field.offset);
+                if (delta > field.floatDeadband || -delta > field.floatDeadband || delta != delta)
+                {
+                    return true;
+                }
+            } else
+            {
+                const int64_t delta = readInt(frame.buf, field) - readInt(m_LastSent, field);
+                if (delta > field.intDeadband || -delta > field.intDeadband)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /** Fields with individual deadbands; only the first m_FieldCount are in use. */
+    Field m_Fields[MAX_FIELDS > 0 ? MAX_FIELDS : 1] = {};
+    /** Number of configured fields; 0 means whole-frame byte compare. */
+    size_t m_FieldCount = 0;
+    /** Payload of the last frame that was let through. */
+    uint8_t m_LastSent[CAN_MAX_DLC] = {};
+    /** DLC of the last frame that was let through. */
+    uint8_t m_LastLen = 0;
+    /** Whether any frame has been let through since construction or forceNext(). */
+    bool m_HasSent = false;
+    /** Time, in milliseconds, of the last frame that was let through. */
+    uint32_t m_LastSentMs = 0;
+    /** Longest time, in milliseconds, a frame may be suppressed for. */
+    uint32_t m_MaxSilenceMs;
+    /** Number of frames let through. */
+    uint32_t m_SentCount = 0;
+    /** Number of frames suppressed. */
+    uint32_t m_SuppressedCount = 0;
+};
+
+#endif //CHANGEFILTER_H
@@ -0,0 +1,334 @@
+#ifndef COBS_H
+#define COBS_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "FrameRing.h"
+
+/** Byte that ends every COBS packet on the wire; it never appears inside an encoded packet. */
+constexpr uint8_t COBS_DELIMITER = 0x00;
+
+/** @return the worst-case encoded length of a payload, including the trailing delimiter */
+constexpr size_t cobsEncodedSize(const size_t size)
+{
+    return size + size / 254 + 2;
+}
+
+/** @return the longest payload whose worst-case encoding, including the delimiter, fits in size bytes */
+constexpr size_t cobsMaxPayloadSize(const size_t size)
+{
+    size_t payload = size < 2 ? 0 : size - 2;
+    while (payload > 0 && cobsEncodedSize(payload) > size)
+    {
+        payload--;
+    }
+    return payload;
+}
+
+/**
+ * <b>One-pass COBS encoder writing straight into an output buffer, such as a serial TX buffer.</b>
+ *
+ * Consistent Overhead Byte Stuffing removes every zero from the payload, so a single zero byte can delimit packets
+ * on a raw byte stream, at a cost of at most one byte per 254. The encoder copies each payload byte once and
+ * back-patches the block length bytes as it goes, so a record can be appended field by field (for example a
+ * CanFrame's ID, timestamp and data straight out of the struct) without first being gathered into a scratch buffer.
+ *
+ * <code>
+ * uint8_t tx[cobsEncodedSize(sizeof(uint32_t) + CAN_MAX_DLC)];
+ * CobsEncoder encoder(tx);
+ * encoder.append(frame.id);
+ * encoder.append(frame.buf, frame.len);
+ * Serial.write(tx, encoder.finish());
+ * </code>
+ */
+class CobsEncoder
+{
+public:
+    /**
+     * @param out the buffer the packet is encoded into
+     * @param capacity the size of out; cobsEncodedSize() of the payload always fits
+     */
+    CobsEncoder(uint8_t* out, const size_t capacity) : m_Out(out), m_Capacity(capacity), m_Ok(capacity > 0)
+    {
+    }
+
+    /** @param out the buffer the packet is encoded into */
+    template <size_t CAPACITY> explicit CobsEncoder(uint8_t (&out)[CAPACITY]) : CobsEncoder(out, CAPACITY)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    CobsEncoder(const CobsEncoder&) = delete;
+    CobsEncoder& operator=(const CobsEncoder&) = delete;
+    CobsEncoder(CobsEncoder&&) = delete;
+    CobsEncoder& operator=(CobsEncoder&&) = delete;
+
+    /** @return false if the output buffer ran out of space, true otherwise */
+    explicit operator bool() const
+    {
+        return m_Ok;
+    }
+
+    /**
+     * <b>Encode the next payload bytes.</b>
+     *
+     * @param data the bytes to append
+     * @param size the number of bytes
+     * @return false if the output buffer is full; the encoder stays failed and finish() returns 0
+     */
+    bool append(const uint8_t* data, const size_t size)
+    {
+        for (size_t i = 0; i < size && m_Ok; i++)
+        {
+            if (data[i] != COBS_DELIMITER)
+            {
+                if (m_Index >= m_Capacity)
+                {
+                    m_Ok = false;
+                    break;
+                }
+                m_Out[m_Index++] = data[i];
+                m_Code++;
+            }
+            if (data[i] == COBS_DELIMITER || m_Code == 0xFF)
+            {
+                closeBlock();
+            }
+        }
+        return m_Ok;
+    }
+
+    /**
+     * <b>Encode the bytes of a trivially copyable value, in native byte order.</b>
+     *
+     * @param value the value to append
+     * @return false if the output buffer is full, true otherwise
+     */
+    template <typename T> bool append(const T& value)
+    {
+        return append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    /**
+     * <b>Close the packet and write the delimiter.</b>
+     *
+     * @return The length of the encoded packet including the delimiter; 0 if the output buffer ran out of space
+     */
+    size_t finish()
+    {
+        if (!m_Ok || m_Index >= m_Capacity)
+        {
+            m_Ok = false;
+            return 0;
+        }
+        m_Out[m_CodeIndex] = m_Code;
+        m_Out[m_Index++] = COBS_DELIMITER;
+        return m_Index;
+    }
+
+private:
+    /** Write the length byte of the current block and start a new one. */
+    void closeBlock()
+    {
+        if (m_Index >= m_Capacity)
+        {
+            m_Ok = false;
+            return;
+        }
+        m_Out[m_CodeIndex] = m_Code;
+        m_CodeIndex = m_Index++;
+        m_Code = 1;
+    }
+
+    /** Buffer the packet is encoded into. */
+    uint8_t* m_Out;
+    /** Size of m_Out. */
+    size_t m_Capacity;
+    /** Position of the current block's length byte. */
+    size_t m_CodeIndex = 0;
+    /** Position of the next payload byte. */
+    size_t m_Index = 1;
+    /** Length byte of the current block: one more than the payload bytes in it. */
+    uint8_t m_Code = 1;
+    /** False once the output buffer ran out of space. */
+    bool m_Ok;
+};
+
+/**
+ * <b>COBS-encode a whole payload in one pass.</b>
+ *
+ * @param data the payload
+ * @param size the payload length
+ * @param out the buffer the packet is encoded into
+ * @param capacity the size of out
+ * @return The length of the encoded packet including the delimiter; 0 if it didn't fit
+ */
+inline size_t cobsEncode(const uint8_t* data, const size_t size, uint8_t* out, const size_t capacity)
+{
+    CobsEncoder encoder(out, capacity);
+    encoder.append(data, size);
+    return encoder.finish();
+}
+
+/** A decoded COBS packet, as stored in a CobsDecoder's ring. */
+template <size_t MAX_PAYLOAD> struct CobsPacket
+{
+    /** Number of valid bytes in data. */
+    uint16_t size = 0;
+    uint8_t data[MAX_PAYLOAD] = {};
+};
+
+/**
+ * <b>Incremental COBS decoder from a byte stream into a ring of preallocated packet slots.</b>
+ *
+ * feed() accepts the stream in pieces of any size, e.g. whatever Serial.readBytes() returned. Each packet is decoded
+ * in place into the slot it will be read from, so payload bytes are copied exactly once. Packets that are malformed
+ * or longer than MAX_PAYLOAD are discarded up to the next delimiter and counted; packets that arrive while every
+ * slot is full are counted as drops by the ring.
+ *
+ * feed() is the ring's producer and the packets are drained on the consumer side, like any FrameRing.
+ *
+ * <code>
+ * CobsDecoder<8, 64> decoder;
+ * decoder.feed(rx, Serial.readBytes(rx, sizeof(rx)));
+ * decoder.getPackets().drain([](const CobsPacket<64>& packet) { handle(packet.data, packet.size); });
+ * </code>
+ * @tparam SLOTS the number of packet slots; must be a power of two
+ * @tparam MAX_PAYLOAD the longest decoded payload a slot holds
+ */
+template <size_t SLOTS = 8, size_t MAX_PAYLOAD = 64> class CobsDecoder
+{
+    static_assert(MAX_PAYLOAD > 0 && MAX_PAYLOAD <= 0xFFFF, "CobsDecoder MAX_PAYLOAD must fit in 16 bits");
+
+public:
+    /** The packet type held in the ring. */
+    using Packet = CobsPacket<MAX_PAYLOAD>;
+
+    CobsDecoder() = default;
+
+    // Delete copy and move constructors/operators
+
+    CobsDecoder(const CobsDecoder&) = delete;
+    CobsDecoder& operator=(const CobsDecoder&) = delete;
+    CobsDecoder(CobsDecoder&&) = delete;
+    CobsDecoder& operator=(CobsDecoder&&) = delete;
+
+    /**
+     * <b>Decode the next bytes of the stream.</b>
+     *
+     * @param data the received bytes
+     * @param size the number of bytes
+     * @return The number of packets completed by these bytes
+     */
+    size_t feed(const uint8_t* data, const size_t size)
+    {
+        size_t completed = 0;
+        for (size_t i = 0; i < size; i++)
+        {
+            const uint8_t byte = data[i];
+            if (byte == COBS_DELIMITER)
+            {
+                completed += endPacket() ? 1 : 0;
+                continue;
+            }
+            if (m_Discarding)
+            {
+                continue;
+            }
+            if (m_Slot == nullptr)
+            {
+                // First byte of a packet is its first length byte
+                m_Slot = m_Packets.acquire();
+                if (m_Slot == nullptr)
+                {
+                    m_Discarding = true;
+                    continue;
+                }
+                m_Slot->size = 0;
+                m_Code = byte;
+                m_Remaining = byte - 1;
+                continue;
+            }
+            if (m_Remaining == 0)
+            {
+                // A block shorter than 254 bytes stood in for a zero, unless the packet ends here
+                if (m_Code != 0xFF && !put(COBS_DELIMITER))
+                {
+                    continue;
+                }
+                m_Code = byte;
+                m_Remaining = byte - 1;
+                continue;
+            }
+            put(byte);
+            m_Remaining--;
+        }
+        return completed;
+    }
+
+    /** @return the ring holding decoded packets */
+    FrameRing<SLOTS, Packet>& getPackets()
+    {
+        return m_Packets;
+    }
+
+    /** @return the number of packets discarded because they were malformed or too long */
+    [[nodiscard]] uint32_t getErrorCount() const
+    {
+        return m_Errors;
+    }
+
+private:
+    /** Append a decoded byte to the current slot, discarding the packet if it doesn't fit. */
+    bool put(const uint8_t byte)
+    {
+        if (m_Slot->size >= MAX_PAYLOAD)
+        {
+            m_Errors++;
+            m_Discarding = true;
+            return false;
+        }
+        m_Slot->data[m_Slot->size++] = byte;
+        return true;
+    }
+
+    /** Handle a delimiter: publish the packet if it is complete and reset for the next one. */
+    bool endPacket()
+    {
+        bool published = false;
+        if (!m_Discarding && m_Slot != nullptr)
+        {
+            if (m_Remaining == 0)
+            {
+                m_Packets.commit();
+                published = true;
+            }
+            else
+            {
+                // Delimiter in the middle of a block
+                m_Errors++;
+            }
+        }
+        m_Slot = nullptr;
+        m_Discarding = false;
+        m_Remaining = 0;
+        return published;
+    }
+
+    /** Decoded packets. */
+    FrameRing<SLOTS, Packet> m_Packets;
+    /** Slot the current packet is decoded into; nullptr between packets. */
+    Packet* m_Slot = nullptr;
+    /** Length byte of the current block. */
+    uint8_t m_Code = 0;
+    /** Payload bytes left in the current block. */
+    uint8_t m_Remaining = 0;
+    /** True while skipping the rest of a bad or dropped packet. */
+    bool m_Discarding = false;
+    /** Packets discarded because they were malformed or too long. */
+    uint32_t m_Errors = 0;
+};
+
+#endif //COBS_H
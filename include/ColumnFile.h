@@ -0,0 +1,335 @@
+#ifndef COLUMNFILE_H
+#define COLUMNFILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "CanFrame.h"
+#include "FrameLog.h"
+
+/*
+ * Column file layout (all fields little-endian):
+ *
+ *   Header      64 bytes  uint32_t magic 'HCOL', uint16_t version, uint8_t value type, uint8_t value size,
+ *                         uint32_t ID, uint32_t reserved, uint64_t sample count, uint64_t timestamps offset,
+ *                         uint64_t values offset, char name[24] (NUL-padded)
+ *   Timestamps  uint64_t per sample, in microseconds, starting at the timestamps offset
+ *   Values      value size bytes per sample, starting at the values offset
+ *
+ * Both columns start on a COLUMN_FILE_ALIGNMENT boundary, so a memory-mapped file can be read as two plain arrays
+ * without copying or unaligned accesses.
+ */
+
+/** Magic number at the start of a column file. */
+constexpr uint32_t COLUMN_FILE_MAGIC = 0x4C4F4348; // "HCOL"
+/** Version of the layout described above. */
+constexpr uint16_t COLUMN_FILE_VERSION = 1;
+/** Size of the header in bytes. */
+constexpr size_t COLUMN_FILE_HEADER_SIZE = 64;
+/** Alignment of the timestamp and value columns; wide enough for any SIMD load. */
+constexpr size_t COLUMN_FILE_ALIGNMENT = 64;
+/** Length of the signal name field, including the NUL padding. */
+constexpr size_t COLUMN_NAME_SIZE = 24;
+
+/** Type of the values in a column. */
+enum class ColumnType : uint8_t
+{
+    U8, I8, U16, I16, U32, I32, F32, Unsupported,
+};
+
+/** @return the ColumnType that stores values of type T */
+template <typename T> constexpr ColumnType columnTypeOf()
+{
+    if constexpr (std::is_same_v<T, uint8_t>) return ColumnType::U8;
+    else if constexpr (std::is_same_v<T, int8_t>) return ColumnType::I8;
+    else if constexpr (std::is_same_v<T, uint16_t>) return ColumnType::U16;
+    else if constexpr (std::is_same_v<T, int16_t>) return ColumnType::I16;
+    else if constexpr (std::is_same_v<T, uint32_t>) return ColumnType::U32;
+    else if constexpr (std::is_same_v<T, int32_t>) return ColumnType::I32;
+    else if constexpr (std::is_same_v<T, float>) return ColumnType::F32;
+    else return ColumnType::Unsupported;
+}
+
+/** @return the size in bytes of one value of a column type; 0 for Unsupported or an unknown type */
+constexpr size_t columnValueSize(const ColumnType type)
+{
+    switch (type)
+    {
+    case ColumnType::U8:
+    case ColumnType::I8:
+        return 1;
+    case ColumnType::U16:
+    case ColumnType::I16:
+        return 2;
+    case ColumnType::U32:
+    case ColumnType::I32:
+    case ColumnType::F32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/** @return the offset of the values column of a file holding count samples */
+constexpr uint64_t columnValuesOffset(const uint64_t count)
+{
+    const uint64_t timestampsEnd = COLUMN_FILE_HEADER_SIZE + count * sizeof(uint64_t);
+    return (timestampsEnd + COLUMN_FILE_ALIGNMENT - 1) / COLUMN_FILE_ALIGNMENT * COLUMN_FILE_ALIGNMENT;
+}
+
+/** Signal name as a single value that BufferPacker can pack and unpack. */
+struct ColumnName
+{
+    char chars[COLUMN_NAME_SIZE];
+};
+
+/**
+ * <b>Extracts a plain field at a fixed payload offset.</b>
+ *
+ * @tparam T the field type
+ */
+template <typename T> struct ColumnField
+{
+    /** Byte offset of the field in the payload. */
+    uint8_t offset;
+
+    /** @return false if the payload is too short to hold the field, true otherwise */
+    bool operator()(const CanFrame& frame, T& value) const
+    {
+        if (offset + sizeof(T) > frame.len)
+        {
+            return false;
+        }
+        memcpy(&value, &frame.buf[offset], sizeof(T));
+        return true;
+    }
+};
+
+/**
+ * <b>Extracts one sub-ID of a multiplexed message through its MuxCodec.</b>
+ *
+ * Batched frames carry several sub-IDs at once; the field only yields a sample when the frame contains its sub-ID.
+ *
+ * @tparam CODEC the MuxCodec instantiation of the message, e.g. TireRpmCodec
+ * @tparam SUB_ID the sub-ID enum of the codec
+ */
+template <typename CODEC, typename SUB_ID> struct ColumnMuxField
+{
+    /** Sub-ID to extract. */
+    SUB_ID sub;
+    /** Codec the frames are decoded through. */
+    CODEC codec = {};
+
+    /** @return true if sub was decoded from the frame, false otherwise */
+    template <typename T> bool operator()(const CanFrame& frame, T& value)
+    {
+        codec.clearUpdated();
+        codec.decode(frame);
+        if (!(codec.getUpdatedMask() & (1u << sub)))
+        {
+            return false;
+        }
+        value = codec.getSlot(sub);
+        return true;
+    }
+};
+
+/**
+ * <b>Transcodes one signal of a row-oriented frame log into a column file.</b>
+ *
+ * The log is read three times through its chunk index - once to count samples, once for the timestamps and once for
+ * the values - so only chunks containing the signal's ID are touched and no memory proportional to the session length
+ * is needed. Columns are written in blocks of BLOCK samples.
+ *
+ * <code>
+ * FileStorage in("session.hflg", false), out("tire_rpm_fl.hcol", true);
+ * FrameLogReader<FileStorage> log(in);
+ * log.open();
+ * transcodeColumn<uint16_t>(log, out, "tire_rpm_fl", TireRPMId, ColumnMuxField<TireRpmCodec, TireSubIDs>{FrontLeftId});
+ * </code>
+ * @tparam T the value type of the column
+ * @tparam BLOCK the number of samples buffered per storage write
+ * @param log an opened FrameLogReader
+ * @param storage the storage to write the column file to; expected to be empty
+ * @param name the signal name stored in the header; truncated to COLUMN_NAME_SIZE - 1 characters
+ * @param id the arbitration ID carrying the signal
+ * @param extract any callable taking (const CanFrame&, T&) and returning true if the frame holds a sample
+ * @return The number of samples written; 0 if a storage write failed
+ */
+template <typename T, size_t BLOCK = 256, typename LOG, typename STORAGE, typename EXTRACT>
+uint64_t transcodeColumn(LOG& log, STORAGE& storage, const char* name, const uint32_t id, EXTRACT extract)
+{
+    static_assert(columnTypeOf<T>() != ColumnType::Unsupported, "Unsupported column value type");
+
+    const uint64_t idMask = frameLogIdBit(id);
+    uint64_t count = 0;
+    log.query(0, UINT64_MAX, idMask, [&](const CanFrame& frame, uint64_t)
+    {
+        T value;
+        count += frame.id == id && extract(frame, value);
+    });
+
+    const uint64_t valuesOffset = columnValuesOffset(count);
+    ColumnName columnName = {};
+    strncpy(columnName.chars, name, COLUMN_NAME_SIZE - 1);
+
+    uint8_t header[COLUMN_FILE_HEADER_SIZE];
+    BufferPacker<COLUMN_FILE_HEADER_SIZE> packer;
+    packer.pack(COLUMN_FILE_MAGIC);
+    packer.pack(COLUMN_FILE_VERSION);
+    packer.pack(static_cast<uint8_t>(columnTypeOf<T>()));
+    packer.pack(static_cast<uint8_t>(sizeof(T)));
+    packer.pack(id);
+    packer.pack(static_cast<uint32_t>(0));
+    packer.pack(count);
+    packer.pack(static_cast<uint64_t>(COLUMN_FILE_HEADER_SIZE));
+    packer.pack(valuesOffset);
+    packer.pack(columnName);
+    packer.deepCopyTo(header);
+    bool failed = storage.write(header, sizeof(header)) != sizeof(header);
+
+    // Timestamps column
+    uint64_t timestamps[BLOCK];
+    size_t buffered = 0;
+    log.query(0, UINT64_MAX, idMask, [&](const CanFrame& frame, const uint64_t timestampUs)
+    {
+        T value;
+        if (frame.id != id || !extract(frame, value))
+        {
+            return;
+        }
+        timestamps[buffered++] = timestampUs;
+        if (buffered == BLOCK)
+        {
+            failed |= storage.write(reinterpret_cast<const uint8_t*>(timestamps), sizeof(timestamps)) != sizeof(timestamps);
+            buffered = 0;
+        }
+    });
+    failed |= storage.write(reinterpret_cast<const uint8_t*>(timestamps), buffered * sizeof(uint64_t)) != buffered * sizeof(uint64_t);
+
+    const uint8_t padding[COLUMN_FILE_ALIGNMENT] = {};
+    const size_t paddingSize = valuesOffset - (COLUMN_FILE_HEADER_SIZE + count * sizeof(uint64_t));
+    failed |= storage.write(padding, paddingSize) != paddingSize;
+
+    // Values column
+    T values[BLOCK];
+    buffered = 0;
+    log.query(0, UINT64_MAX, idMask, [&](const CanFrame& frame, uint64_t)
+    {
+        if (frame.id != id || !extract(frame, values[buffered]))
+        {
+            return;
+        }
+        if (++buffered == BLOCK)
+        {
+            failed |= storage.write(reinterpret_cast<const uint8_t*>(values), sizeof(values)) != sizeof(values);
+            buffered = 0;
+        }
+    });
+    failed |= storage.write(reinterpret_cast<const uint8_t*>(values), buffered * sizeof(T)) != buffered * sizeof(T);
+
+    return failed ? 0 : count;
+}
+
+/**
+ * <b>Zero-copy view of a column file that is already in memory, typically through mmap().</b>
+ *
+ * <code>
+ * ColumnView column(mapped, mappedSize);
+ * const uint16_t* rpm = column.values<uint16_t>();
+ * for (uint64_t i = 0; i < column.getCount(); i++) { ... rpm[i] ... column.timestamps()[i] ... }
+ * </code>
+ */
+class ColumnView
+{
+public:
+    /**
+     * @param data the start of the file; must be aligned to at least 8 bytes (mmap() gives page alignment)
+     * @param size the length of the file in bytes
+     */
+    ColumnView(const uint8_t* data, const size_t size) : m_Data(data)
+    {
+        if (data == nullptr || size < COLUMN_FILE_HEADER_SIZE)
+        {
+            return;
+        }
+        BufferPacker<COLUMN_FILE_HEADER_SIZE> unpacker(data, COLUMN_FILE_HEADER_SIZE);
+        const auto magic = unpacker.unpack<uint32_t>();
+        const auto version = unpacker.unpack<uint16_t>();
+        m_Type = static_cast<ColumnType>(unpacker.unpack<uint8_t>());
+        m_ValueSize = unpacker.unpack<uint8_t>();
+        m_Id = unpacker.unpack<uint32_t>();
+        unpacker.skip<uint32_t>();
+        m_Count = unpacker.unpack<uint64_t>();
+        m_TimestampsOffset = unpacker.unpack<uint64_t>();
+        m_ValuesOffset = unpacker.unpack<uint64_t>();
+        m_Name = unpacker.unpack<ColumnName>();
+        m_Name.chars[COLUMN_NAME_SIZE - 1] = '\0';
+        // The file is untrusted: bound the count by division so no offset arithmetic can wrap
+        m_Valid = unpacker && magic == COLUMN_FILE_MAGIC && version == COLUMN_FILE_VERSION &&
+            m_ValueSize != 0 && m_ValueSize == columnValueSize(m_Type) &&
+            m_TimestampsOffset % COLUMN_FILE_ALIGNMENT == 0 && m_ValuesOffset % COLUMN_FILE_ALIGNMENT == 0 &&
+            m_TimestampsOffset >= COLUMN_FILE_HEADER_SIZE && m_TimestampsOffset <= m_ValuesOffset &&
+            m_ValuesOffset <= size && m_Count <= (m_ValuesOffset - m_TimestampsOffset) / sizeof(uint64_t) &&
+            m_Count <= (size - m_ValuesOffset) / m_ValueSize;
+    }
+
+    /** This conversion returns false if the file is malformed or truncated, true otherwise. */
+    explicit operator bool() const
+    {
+        return m_Valid;
+    }
+
+    /** @return the number of samples */
+    [[nodiscard]] uint64_t getCount() const
+    {
+        return m_Valid ? m_Count : 0;
+    }
+
+    /** @return the arbitration ID the signal was extracted from */
+    [[nodiscard]] uint32_t getId() const
+    {
+        return m_Id;
+    }
+
+    /** @return the value type of the column */
+    [[nodiscard]] ColumnType getType() const
+    {
+        return m_Type;
+    }
+
+    /** @return the NUL-terminated signal name */
+    [[nodiscard]] const char* getName() const
+    {
+        return m_Name.chars;
+    }
+
+    /** @return the timestamps column in microseconds; nullptr if the file is invalid */
+    [[nodiscard]] const uint64_t* timestamps() const
+    {
+        return m_Valid ? reinterpret_cast<const uint64_t*>(m_Data + m_TimestampsOffset) : nullptr;
+    }
+
+    /** @return the values column; nullptr if the file is invalid or T doesn't match its value type */
+    template <typename T> [[nodiscard]] const T* values() const
+    {
+        return m_Valid && columnTypeOf<T>() == m_Type ? reinterpret_cast<const T*>(m_Data + m_ValuesOffset) : nullptr;
+    }
+
+private:
+    /** Start of the file. */
+    const uint8_t* m_Data;
+    /** True if the header checked out against the file size. */
+    bool m_Valid = false;
+    ColumnType m_Type = ColumnType::Unsupported;
+    uint8_t m_ValueSize = 0;
+    uint32_t m_Id = 0;
+    uint64_t m_Count = 0;
+    uint64_t m_TimestampsOffset = 0;
+    uint64_t m_ValuesOffset = 0;
+    ColumnName m_Name = {};
+};
+
+#endif //COLUMNFILE_H
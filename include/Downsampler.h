@@ -0,0 +1,402 @@
+#ifndef DOWNSAMPLER_H
+#define DOWNSAMPLER_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "Reserved.h"
+
+/** One output sample of a downsampling stage. */
+struct DownsampleSample
+{
+    /** Smallest input in the bucket; equal to value for FIR decimation. */
+    int32_t min;
+    /** Largest input in the bucket; equal to value for FIR decimation. */
+    int32_t max;
+    /** Rounded bucket mean, or the low-pass filtered sample for FIR decimation. */
+    int32_t value;
+};
+
+/**
+ * <b>Reduces every FACTOR input samples to their minimum, maximum and mean.</b>
+ *
+ * Unlike keeping every Nth sample, peaks survive in min/max and the mean doesn't alias. Integer only.
+ */
+class BucketReducer
+{
+public:
+    /** @param factor the number of input samples per output sample; 0 is treated as 1 */
+    explicit BucketReducer(const uint16_t factor = 1)
+    {
+        setFactor(factor);
+    }
+
+    /** <b>Change the decimation factor and discard the partially filled bucket.</b> */
+    void setFactor(const uint16_t factor)
+    {
+        m_Factor = factor > 0 ? factor : 1;
+        m_Count = 0;
+    }
+
+    /**
+     * <b>Add one input sample.</b>
+     *
+     * @param sample the input sample
+     * @param out receives the bucket's statistics when the bucket completes
+     * @return true if a bucket completed and out was written, false otherwise
+     */
+    bool push(const int32_t sample, DownsampleSample& out)
+    {
+        if (m_Count == 0)
+        {
+            m_Min = sample;
+            m_Max = sample;
+            m_Sum = 0;
+        }
+        m_Min = sample < m_Min ? sample : m_Min;
+        m_Max = sample > m_Max ? sample : m_Max;
+        m_Sum += sample;
+        if (++m_Count < m_Factor)
+        {
+            return false;
+        }
+        // Round half away from zero
+        const int64_t half = m_Factor / 2;
+        out = {m_Min, m_Max, static_cast<int32_t>((m_Sum >= 0 ? m_Sum + half : m_Sum - half) / m_Factor)};
+        m_Count = 0;
+        return true;
+    }
+
+    /**
+     * <b>Reduce a block of input samples.</b>
+     *
+     * @param in the input samples
+     * @param count the number of input samples
+     * @param out receives up to count / factor + 1 output samples
+     * @return The number of output samples written
+     */
+    size_t process(const int32_t* in, const size_t count, DownsampleSample* out)
+    {
+        size_t produced = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            produced += push(in[i], out[produced]);
+        }
+        return produced;
+    }
+
+private:
+    uint16_t m_Factor = 1;
+    uint16_t m_Count = 0;
+    int32_t m_Min = 0;
+    int32_t m_Max = 0;
+    int64_t m_Sum = 0;
+};
+
+/**
+ * <b>Decimating low-pass FIR filter with Q15 coefficients.</b>
+ *
+ * setFactor() designs a linear-phase, Hamming-windowed sinc low-pass with its cutoff at the new Nyquist frequency, so
+ * content that would alias is removed before only every FACTOR-th output is kept. Outputs that would be thrown away
+ * are never computed.
+ *
+ * Inputs are appended to a linear delay line, so every output is one contiguous multiply-accumulate over TAPS samples
+ * (a chain of SMLAL on the Cortex-M7, auto-vectorized on the host). The line is only shifted once every BLOCK inputs.
+ *
+ * @tparam TAPS the number of filter taps; should be at least 2 * factor for useful attenuation
+ * @tparam BLOCK the number of inputs between delay line shifts
+ */
+template <size_t TAPS = 16, size_t BLOCK = 64> class FirDecimator
+{
+    static_assert(TAPS >= 2, "FirDecimator needs at least two taps");
+    static_assert(BLOCK > 0, "FirDecimator BLOCK must not be empty");
+
+public:
+    /** @param factor the number of input samples per output sample; 0 is treated as 1 */
+    explicit FirDecimator(const uint16_t factor = 1)
+    {
+        setFactor(factor);
+    }
+
+    /**
+     * <b>Design the filter for a new decimation factor and clear its history.</b>
+     *
+     * Uses floating point once; filtering itself is integer only.
+     */
+    void setFactor(const uint16_t factor)
+    {
+        m_Factor = factor > 0 ? factor : 1;
+        constexpr float PI = 3.14159265f;
+        const float cutoff = 0.5f / m_Factor;
+        const float center = (TAPS - 1) / 2.0f;
+        float taps[TAPS];
+        float sum = 0;
+        for (size_t k = 0; k < TAPS; k++)
+        {
+            const float x = k - center;
+            const float sinc = x == 0 ? 2 * cutoff : sinf(2 * PI * cutoff * x) / (PI * x);
+            const float window = 0.54f - 0.46f * cosf(2 * PI * k / (TAPS - 1));
+            taps[k] = sinc * window;
+            sum += taps[k];
+        }
+        // Normalize to unity DC gain, putting the rounding error on the center tap
+        int32_t total = 0;
+        for (size_t k = 0; k < TAPS; k++)
+        {
+            m_Coefficients[k] = static_cast<int32_t>(lroundf(taps[k] / sum * Q15_ONE));
+            total += m_Coefficients[k];
+        }
+        m_Coefficients[TAPS / 2] += Q15_ONE - total;
+        reset();
+    }
+
+    /** <b>Clear the filter history.</b> */
+    void reset()
+    {
+        memset(m_Line, 0, sizeof(m_Line));
+        m_Fill = 0;
+        m_Phase = 0;
+    }
+
+    /**
+     * <b>Add one input sample.</b>
+     *
+     * @param sample the input sample
+     * @param out receives the filtered, decimated sample
+     * @return true if this input produced an output, false otherwise
+     */
+    bool push(const int32_t sample, DownsampleSample& out)
+    {
+        if (m_Fill == BLOCK)
+        {
+            memmove(m_Line, &m_Line[BLOCK], (TAPS - 1) * sizeof(int32_t));
+            m_Fill = 0;
+        }
+        m_Line[TAPS - 1 + m_Fill++] = sample;
+        if (++m_Phase < m_Factor)
+        {
+            return false;
+        }
+        m_Phase = 0;
+        const int32_t value = filterAt(m_Fill);
+        out = {value, value, value};
+        return true;
+    }
+
+    /**
+     * <b>Filter and decimate a block of input samples.</b>
+     *
+     * @param in the input samples
+     * @param count the number of input samples
+     * @param out receives up to count / factor + 1 output samples
+     * @return The number of output samples written
+     */
+    size_t process(const int32_t* in, const size_t count, DownsampleSample* out)
+    {
+        size_t produced = 0;
+        size_t consumed = 0;
+        while (consumed < count)
+        {
+            if (m_Fill == BLOCK)
+            {
+                memmove(m_Line, &m_Line[BLOCK], (TAPS - 1) * sizeof(int32_t));
+                m_Fill = 0;
+            }
+            // Copy as much as fits, then compute only the outputs that are kept
+            const size_t chunk = count - consumed < BLOCK - m_Fill ? count - consumed : BLOCK - m_Fill;
+            memcpy(&m_Line[TAPS - 1 + m_Fill], &in[consumed], chunk * sizeof(int32_t));
+            size_t next = m_Factor - m_Phase;
+            while (next <= chunk)
+            {
+                const int32_t value = filterAt(m_Fill + next);
+                out[produced++] = {value, value, value};
+                next += m_Factor;
+            }
+            m_Phase = static_cast<uint16_t>((m_Phase + chunk) % m_Factor);
+            m_Fill += chunk;
+            consumed += chunk;
+        }
+        return produced;
+    }
+
+    /** @return the Q15 coefficient of tap k */
+    [[nodiscard]] int32_t getCoefficient(const size_t k) const
+    {
+        return k < TAPS ? m_Coefficients[k] : 0;
+    }
+
+private:
+    /** 1.0 in Q15. */
+    static constexpr int32_t Q15_ONE = 1 << 15;
+
+    /** @return the filter output for the input that ends at m_Line[TAPS - 2 + end] */
+    int32_t filterAt(const size_t end) const
+    {
+        const int32_t* window = &m_Line[end - 1];
+        int64_t accumulator = 0;
+        for (size_t k = 0; k < TAPS; k++)
+        {
+            accumulator += static_cast<int64_t>(m_Coefficients[k]) * window[k];
+        }
+        return static_cast<int32_t>((accumulator + (Q15_ONE >> 1)) >> 15);
+    }
+
+    /** Filter coefficients in Q15, widened so 1.0 fits; symmetric, so their order against the delay line doesn't matter. */
+    int32_t m_Coefficients[TAPS] = {};
+    /** Delay line: the last TAPS - 1 inputs of the previous block, then up to BLOCK new inputs. */
+    int32_t m_Line[TAPS - 1 + BLOCK] = {};
+    /** Number of new inputs in the delay line. */
+    size_t m_Fill = 0;
+    uint16_t m_Factor = 1;
+    /** Inputs since the last output. */
+    uint16_t m_Phase = 0;
+};
+
+/** Downsampling method of a signal. */
+enum class DownsampleMode : uint8_t
+{
+    /** Min/max/mean per bucket of factor samples. */
+    Bucket,
+    /** Low-pass FIR filter, then keep every factor-th sample. */
+    Fir,
+};
+
+/**
+ * <b>Per-signal downsampling stage, configured per ReservedIDs.</b>
+ *
+ * Each configured ID gets its own BucketReducer or FirDecimator. Finding the stage of an ID is a dense
+ * reservedIdIndex() lookup, so push() costs the same for every ID. IDs that aren't configured pass nothing through.
+ *
+ * <code>
+ * Downsampler<> downsampler;
+ * downsampler.configure(Throttle1PositionId, DownsampleMode::Bucket, 10);   // 1 kHz -> 100 Hz
+ * downsampler.configure(SteeringWheelAngleId, DownsampleMode::Fir, 4);
+ * DownsampleSample out;
+ * if (downsampler.push(Throttle1PositionId, raw, out)) { telemetry.send(out); }
+ * </code>
+ * @tparam MAX_SIGNALS the maximum number of configured IDs
+ * @tparam TAPS the number of taps of every FIR stage
+ */
+template <size_t MAX_SIGNALS = 8, size_t TAPS = 16> class Downsampler
+{
+    static_assert(MAX_SIGNALS > 0 && MAX_SIGNALS < 0xFF, "Downsampler supports 1 to 254 signals");
+
+public:
+    Downsampler()
+    {
+        memset(m_Slots, NO_SLOT, sizeof(m_Slots));
+    }
+
+    /**
+     * <b>Configure, or reconfigure, the downsampling of one ID.</b>
+     *
+     * @param id the reserved ID carrying the signal
+     * @param mode the downsampling method
+     * @param factor the number of input samples per output sample
+     * @return false if id isn't a reserved ID or MAX_SIGNALS IDs are already configured, true otherwise
+     */
+    bool configure(const uint32_t id, const DownsampleMode mode, const uint16_t factor)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index >= RESERVED_ID_COUNT)
+        {
+            return false;
+        }
+        if (m_Slots[index] == NO_SLOT)
+        {
+            if (m_SignalCount >= MAX_SIGNALS)
+            {
+                return false;
+            }
+            m_Slots[index] = static_cast<uint8_t>(m_SignalCount++);
+        }
+        Signal& signal = m_Signals[m_Slots[index]];
+        signal.mode = mode;
+        if (mode == DownsampleMode::Fir)
+        {
+            signal.fir.setFactor(factor);
+        }
+        else
+        {
+            signal.bucket.setFactor(factor);
+        }
+        return true;
+    }
+
+    /** @return true if id has a downsampling stage */
+    [[nodiscard]] bool isConfigured(const uint32_t id) const
+    {
+        const size_t index = reservedIdIndex(id);
+        return index < RESERVED_ID_COUNT && m_Slots[index] != NO_SLOT;
+    }
+
+    /**
+     * <b>Add one sample of an ID's signal.</b>
+     *
+     * @param id the ID the sample came from
+     * @param sample the input sample
+     * @param out receives the downsampled sample
+     * @return true if an output sample was produced, false otherwise (including unconfigured IDs)
+     */
+    bool push(const uint32_t id, const int32_t sample, DownsampleSample& out)
+    {
+        Signal* signal = find(id);
+        if (signal == nullptr)
+        {
+            return false;
+        }
+        return signal->mode == DownsampleMode::Fir ? signal->fir.push(sample, out) : signal->bucket.push(sample, out);
+    }
+
+    /**
+     * <b>Downsample a block of one ID's samples, e.g. a column on the host.</b>
+     *
+     * @param id the ID the samples came from
+     * @param in the input samples
+     * @param count the number of input samples
+     * @param out receives up to count / factor + 1 output samples
+     * @return The number of output samples written; 0 for unconfigured IDs
+     */
+    size_t process(const uint32_t id, const int32_t* in, const size_t count, DownsampleSample* out)
+    {
+        Signal* signal = find(id);
+        if (signal == nullptr)
+        {
+            return 0;
+        }
+        return signal->mode == DownsampleMode::Fir ? signal->fir.process(in, count, out) : signal->bucket.process(in, count, out);
+    }
+
+private:
+    /** Slot value of an unconfigured ID. */
+    static constexpr uint8_t NO_SLOT = 0xFF;
+
+    /** Downsampling state of one configured ID. */
+    struct Signal
+    {
+        DownsampleMode mode = DownsampleMode::Bucket;
+        BucketReducer bucket;
+        FirDecimator<TAPS> fir;
+    };
+
+    Signal* find(const uint32_t id)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index >= RESERVED_ID_COUNT || m_Slots[index] == NO_SLOT)
+        {
+            return nullptr;
+        }
+        return &m_Signals[m_Slots[index]];
+    }
+
+    /** Index into m_Signals for every reservedIdIndex(); NO_SLOT if unconfigured. */
+    uint8_t m_Slots[RESERVED_ID_COUNT];
+    /** Configured signals, in configuration order. */
+    Signal m_Signals[MAX_SIGNALS];
+    /** Number of configured signals. */
+    size_t m_SignalCount = 0;
+};
+
+#endif //DOWNSAMPLER_H
@@ -0,0 +1,274 @@
+#ifndef FAULTENGINE_H
+#define FAULTENGINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/** Number of FaultSourcesIDs. */
+constexpr size_t FAULT_SOURCE_COUNT = StartFaultId + 1;
+
+/** @return the bit that represents source in a fault mask */
+constexpr uint8_t faultBit(const FaultSourcesIDs source)
+{
+    return static_cast<uint8_t>(1u << source);
+}
+
+/**
+ * <b>Latched fault state for every FaultSourcesIDs, kept in a single atomic bitmask.</b>
+ *
+ * The low byte of the state is the <b>active</b> mask, which says which faults are present right now. The high byte is
+ * the <b>latched</b> mask, which says which faults have been present since they were last cleared. Keeping both in one
+ * word means every read sees an active/latched pair that belongs together.
+ *
+ * Fault sources report raw observations through report(); a fault only becomes active after setCount consecutive
+ * "present" reports and only stops being active after clearCount consecutive "absent" reports. A latched fault can
+ * only be cleared once it is no longer active.
+ *
+ * Each source should be reported from a single context, but the state itself is atomic, so it can be read
+ * (or faults raised) from anywhere, including interrupts. Checking, packing and sending the whole fault state is O(1)
+ * no matter how many faults are active, and takes a single FaultId frame.
+ *
+ * <code>
+ * FaultEngine faults;
+ * faults.setDebounce(BrakeZeroId, 5, 5);
+ * faults.report(BrakeZeroId, brakeReading == 0);
+ * if (faults.hasChanged()) { faults.packFrame(frame); can.write(frame); }
+ * </code>
+ */
+class FaultEngine
+{
+    static_assert(FAULT_SOURCE_COUNT <= 8, "FaultEngine packs the fault masks into single bytes");
+
+public:
+    /** A FaultEngine starts with no faults and every source activating and deactivating on its first report. */
+    FaultEngine() : m_State(0), m_Version(0)
+    {
+        for (size_t i = 0; i < FAULT_SOURCE_COUNT; i++)
+        {
+            m_SetCounts[i] = 1;
+            m_ClearCounts[i] = 1;
+            m_Counters[i] = 0;
+        }
+    }
+
+    // Delete copy and move constructors/operators
+
+    FaultEngine(const FaultEngine&) = delete;
+    FaultEngine& operator=(const FaultEngine&) = delete;
+    FaultEngine(FaultEngine&&) = delete;
+    FaultEngine& operator=(FaultEngine&&) = delete;
+
+    /**
+     * <b>Set how many consecutive reports it takes for a source to change state.</b>
+     *
+     * @param source the fault source to configure
+     * @param setCount consecutive "present" reports needed to activate the fault; 0 is treated as 1
+     * @param clearCount consecutive "absent" reports needed to deactivate the fault; 0 is treated as 1
+     */
+    void setDebounce(const FaultSourcesIDs source, const uint8_t setCount, const uint8_t clearCount)
+    {
+        if (source >= FAULT_SOURCE_COUNT)
+        {
+            return;
+        }
+        m_SetCounts[source] = setCount > 0 ? setCount : 1;
+        m_ClearCounts[source] = clearCount > 0 ? clearCount : 1;
+        m_Counters[source] = 0;
+    }
+
+    /**
+     * <b>Report one raw observation of a fault source.</b>
+     *
+     * @param source the fault source that was evaluated
+     * @param present whether the fault condition was observed
+     */
+    void report(const FaultSourcesIDs source, const bool present)
+    {
+        if (source >= FAULT_SOURCE_COUNT)
+        {
+            return;
+        }
+        const uint8_t bit = faultBit(source);
+        const bool active = (getActiveMask() & bit) != 0;
+        if (present == active)
+        {
+            // Observation agrees with the current state - restart the debounce
+            m_Counters[source] = 0;
+            return;
+        }
+        if (++m_Counters[source] < (present ? m_SetCounts[source] : m_ClearCounts[source]))
+        {
+            return;
+        }
+        m_Counters[source] = 0;
+        if (present)
+        {
+            raise(source);
+        } else
+        {
+            m_State.fetch_and(static_cast<uint16_t>(~bit), std::memory_order_acq_rel);
+            m_Version.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * <b>Activate and latch a fault immediately, bypassing the debounce.</b>
+     *
+     * @param source the fault source to raise
+     */
+    void raise(const FaultSourcesIDs source)
+    {
+        if (source >= FAULT_SOURCE_COUNT)
+        {
+            return;
+        }
+        const uint16_t bits = static_cast<uint16_t>(faultBit(source) | (faultBit(source) << 8));
+        const uint16_t previous = m_State.fetch_or(bits, std::memory_order_acq_rel);
+        if ((previous & bits) != bits)
+        {
+            m_Version.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * <b>Clear a latched fault.</b>
+     *
+     * A fault that is still active stays latched.
+     *
+     * @param source the fault source to clear
+     * @return true if the fault is no longer latched, false if it is still active
+     */
+    bool clear(const FaultSourcesIDs source)
+    {
+        if (source >= FAULT_SOURCE_COUNT)
+        {
+            return true;
+        }
+        return (clearMask(faultBit(source)) & faultBit(source)) == 0;
+    }
+
+    /**
+     * <b>Clear every latched fault that is no longer active.</b>
+     *
+     * @return the latched mask after clearing
+     */
+    uint8_t clearAll()
+    {
+        return clearMask(ALL_FAULTS);
+    }
+
+    /** @return a mask of the faults that are present right now */
+    [[nodiscard]] uint8_t getActiveMask() const
+    {
+        return static_cast<uint8_t>(m_State.load(std::memory_order_acquire));
+    }
+
+    /** @return a mask of the faults that have been present since they were last cleared */
+    [[nodiscard]] uint8_t getLatchedMask() const
+    {
+        return static_cast<uint8_t>(m_State.load(std::memory_order_acquire) >> 8);
+    }
+
+    /** @return true if source is present right now */
+    [[nodiscard]] bool isActive(const FaultSourcesIDs source) const
+    {
+        return source < FAULT_SOURCE_COUNT && (getActiveMask() & faultBit(source)) != 0;
+    }
+
+    /** @return true if source has been present since it was last cleared */
+    [[nodiscard]] bool isLatched(const FaultSourcesIDs source) const
+    {
+        return source < FAULT_SOURCE_COUNT && (getLatchedMask() & faultBit(source)) != 0;
+    }
+
+    /** @return true if any fault is latched */
+    [[nodiscard]] bool any() const
+    {
+        return getLatchedMask() != 0;
+    }
+
+    /**
+     * @return true if the fault state changed since the last packFrame(); use it to send FaultId on change only
+     */
+    [[nodiscard]] bool hasChanged() const
+    {
+        return m_Version.load(std::memory_order_acquire) != m_PackedVersion;
+    }
+
+    /**
+     * <b>Pack the complete fault state into a single FaultId frame.</b>
+     *
+     * The payload is uint8_t active mask, uint8_t latched mask and uint8_t change counter, packed with BufferPacker.
+     *
+     * @param frame the frame to pack into
+     * @return false if packing failed, true otherwise
+     */
+    bool packFrame(CanFrame& frame)
+    {
+        m_PackedVersion = m_Version.load(std::memory_order_acquire);
+        const uint16_t state = m_State.load(std::memory_order_acquire);
+        BufferPacker<3 * sizeof(uint8_t)> packer;
+        packer.pack(static_cast<uint8_t>(state));
+        packer.pack(static_cast<uint8_t>(state >> 8));
+        packer.pack(static_cast<uint8_t>(m_PackedVersion));
+        return frame.pack(FaultId, packer);
+    }
+
+    /**
+     * <b>Unpack a FaultId frame produced by packFrame().</b>
+     *
+     * @param frame the received FaultId frame
+     * @param active receives the active mask
+     * @param latched receives the latched mask
+     * @return false if the frame is too short, true otherwise
+     */
+    static bool unpackFrame(const CanFrame& frame, uint8_t& active, uint8_t& latched)
+    {
+        auto unpacker = frame.unpacker();
+        active = unpacker.unpack<uint8_t>();
+        latched = unpacker.unpack<uint8_t>();
+        return static_cast<bool>(unpacker);
+    }
+
+private:
+    /** Mask with a bit set for every fault source. */
+    static constexpr uint8_t ALL_FAULTS = static_cast<uint8_t>((1u << FAULT_SOURCE_COUNT) - 1);
+
+    /** Clear the latched bits in mask that aren't active; returns the resulting latched mask. */
+    uint8_t clearMask(const uint8_t mask)
+    {
+        uint16_t state = m_State.load(std::memory_order_acquire);
+        uint16_t cleared;
+        do
+        {
+            // Only latched bits whose fault is no longer active can be cleared
+            const uint8_t clearable = mask & static_cast<uint8_t>(~state);
+            cleared = state & static_cast<uint16_t>(~(clearable << 8));
+        } while (cleared != state &&
+                 !m_State.compare_exchange_weak(state, cleared, std::memory_order_acq_rel, std::memory_order_acquire));
+        if (cleared != state)
+        {
+            m_Version.fetch_add(1, std::memory_order_release);
+        }
+        return static_cast<uint8_t>(cleared >> 8);
+    }
+
+    /** Active mask in the low byte, latched mask in the high byte. */
+    std::atomic<uint16_t> m_State;
+    /** Incremented on every change of either mask. */
+    std::atomic<uint32_t> m_Version;
+    /** Value of m_Version when the state was last packed. */
+    uint32_t m_PackedVersion = 0;
+    /** Consecutive reports needed to activate each source. */
+    uint8_t m_SetCounts[FAULT_SOURCE_COUNT];
+    /** Consecutive reports needed to deactivate each source. */
+    uint8_t m_ClearCounts[FAULT_SOURCE_COUNT];
+    /** Consecutive reports disagreeing with each source's current state. */
+    uint8_t m_Counters[FAULT_SOURCE_COUNT];
+};
+
+#endif //FAULTENGINE_H
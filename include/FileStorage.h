@@ -0,0 +1,114 @@
+#ifndef FILESTORAGE_H
+#define FILESTORAGE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+/**
+ * <b>Storage backend over a plain stdio file, for host builds and tests.</b>
+ *
+ * Provides the storage interface shared by the log writers, readers and sinks in this library:
+ * - write(const uint8_t*, size_t) appends bytes and returns how many were written
+ * - read(uint64_t, uint8_t*, size_t) reads bytes at an absolute offset and returns how many were read
+ * - size() returns the current length of the file
+ *
+ * On the car, an SD card file wrapper with the same three methods takes its place.
+ */
+class FileStorage
+{
+public:
+    /**
+     * @param path the file to open
+     * @param truncate true to start a new, empty file for writing, false to open an existing file for reading
+     */
+    FileStorage(const char* path, const bool truncate)
+    {
+        m_File = fopen(path, truncate ? "w+b" : "rb");
+    }
+
+    ~FileStorage()
+    {
+        if (m_File != nullptr)
+        {
+            fclose(m_File);
+        }
+    }
+
+    // Delete copy and move constructors/operators
+
+    FileStorage(const FileStorage&) = delete;
+    FileStorage& operator=(const FileStorage&) = delete;
+    FileStorage(FileStorage&&) = delete;
+    FileStorage& operator=(FileStorage&&) = delete;
+
+    /** This conversion returns false if the file couldn't be opened, true otherwise. */
+    explicit operator bool() const
+    {
+        return m_File != nullptr;
+    }
+
+    /**
+     * <b>Append bytes to the end of the file.</b>
+     *
+     * @return The number of bytes written
+     */
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        if (m_File == nullptr || fseek(m_File, 0, SEEK_END) != 0)
+        {
+            m_Failed = true;
+            return 0;
+        }
+        const size_t written = fwrite(data, 1, size, m_File);
+        m_Failed |= written != size;
+        return written;
+    }
+
+    /**
+     * <b>Read bytes starting at an absolute offset.</b>
+     *
+     * @return The number of bytes read; less than size at the end of the file
+     */
+    size_t read(const uint64_t offset, uint8_t* data, const size_t size)
+    {
+        if (m_File == nullptr || fseeko(m_File, static_cast<off_t>(offset), SEEK_SET) != 0)
+        {
+            return 0;
+        }
+        return fread(data, 1, size, m_File);
+    }
+
+    /** @return the length of the file in bytes */
+    [[nodiscard]] uint64_t size()
+    {
+        if (m_File == nullptr || fseeko(m_File, 0, SEEK_END) != 0)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(ftello(m_File));
+    }
+
+    /**
+     * <b>Push buffered writes to the operating system.</b>
+     *
+     * @return false if this or any earlier write failed, e.g. because the disk is full; true otherwise
+     */
+    bool flush()
+    {
+        if (m_File == nullptr)
+        {
+            return false;
+        }
+        m_Failed |= fflush(m_File) != 0 || ferror(m_File) != 0;
+        return !m_Failed;
+    }
+
+private:
+    /** Underlying stdio file; nullptr if it couldn't be opened. */
+    FILE* m_File;
+    /** True once a write or flush came up short; stays set. */
+    bool m_Failed = false;
+};
+
+#endif //FILESTORAGE_H
@@ -0,0 +1,599 @@
+#ifndef FRAMELOG_H
+#define FRAMELOG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/*
+ * Binary frame log layout (all fields little-endian, packed with BufferPacker):
+ *
+ *   File header   16 bytes  uint32_t magic 'HFLG', uint16_t version, uint16_t reserved, uint32_t chunk size,
+ *                           uint32_t reserved
+ *   Chunk 0..N-1  chunk size bytes each, at offset 16 + i * chunk size
+ *     Chunk header  32 bytes  uint32_t magic 'CHNK', uint16_t record count, uint16_t reserved,
+ *                             uint64_t first timestamp, uint64_t last timestamp, uint64_t ID mask
+ *     Records       18 bytes each  uint32_t timestamp delta from the chunk's first timestamp, uint32_t ID,
+ *                                  uint8_t len, uint8_t flags (bit 0: extended), uint8_t data[8]
+ *   Index         24 bytes per entry  uint64_t first timestamp, uint64_t last timestamp, uint64_t ID mask
+ *   Footer        16 bytes  uint32_t magic 'HFIX', uint32_t chunk count, uint32_t entry count, uint32_t chunks per entry
+ *
+ * Timestamps are in microseconds. ID masks have bit reservedIdIndex(id) set for every ID present, with
+ * RESERVED_ID_COUNT standing in for all unreserved IDs. Each index entry summarizes "chunks per entry" consecutive
+ * chunks, so the index stays a bounded size however long the session is.
+ */
+
+/** Magic number at the start of a frame log. */
+constexpr uint32_t FRAME_LOG_MAGIC = 0x474C4648; // "HFLG"
+/** Magic number at the start of every chunk. */
+constexpr uint32_t FRAME_LOG_CHUNK_MAGIC = 0x4B4E4843; // "CHNK"
+/** Magic number at the start of the footer. */
+constexpr uint32_t FRAME_LOG_INDEX_MAGIC = 0x58494648; // "HFIX"
+/** Version of the layout described above; bumped whenever reservedIdIndex() changes, since ID masks depend on it. */
+constexpr uint16_t FRAME_LOG_VERSION = 2;
+/** Size of the file header in bytes. */
+constexpr size_t FRAME_LOG_HEADER_SIZE = 16;
+/** Size of a chunk header in bytes. */
+constexpr size_t FRAME_LOG_CHUNK_HEADER_SIZE = 32;
+/** Size of a record in bytes. */
+constexpr size_t FRAME_LOG_RECORD_SIZE = 18;
+/** Size of an index entry in bytes. */
+constexpr size_t FRAME_LOG_INDEX_ENTRY_SIZE = 24;
+/** Size of the footer in bytes. */
+constexpr size_t FRAME_LOG_FOOTER_SIZE = 16;
+
+/** @return the bit that represents id in a frame log ID mask */
+constexpr uint64_t frameLogIdBit(const uint32_t id)
+{
+    return static_cast<uint64_t>(1) << reservedIdIndex(id);
+}
+
+/** Frame payload bytes as a single value that BufferPacker can pack and unpack. */
+struct FrameLogPayload
+{
+    uint8_t bytes[CAN_MAX_DLC];
+};
+
+/** Summary of a range of the log: its time span and the IDs it contains. */
+struct FrameLogSummary
+{
+    uint64_t firstUs = UINT64_MAX;
+    uint64_t lastUs = 0;
+    uint64_t idMask = 0;
+
+    /** Widen the summary to include a frame. */
+    void add(const uint64_t timestampUs, const uint32_t id)
+    {
+        firstUs = timestampUs < firstUs ? timestampUs : firstUs;
+        lastUs = timestampUs > lastUs ? timestampUs : lastUs;
+        idMask |= frameLogIdBit(id);
+    }
+
+    /** Widen the summary to include another summary. */
+    void merge(const FrameLogSummary& other)
+    {
+        firstUs = other.firstUs < firstUs ? other.firstUs : firstUs;
+        lastUs = other.lastUs > lastUs ? other.lastUs : lastUs;
+        idMask |= other.idMask;
+    }
+
+    /** @return true if the summary may contain frames with idMask in [startUs, endUs] */
+    [[nodiscard]] bool matches(const uint64_t startUs, const uint64_t endUs, const uint64_t mask) const
+    {
+        return lastUs >= startUs && firstUs <= endUs && (idMask & mask) != 0;
+    }
+};
+
+static_assert(RESERVED_ID_COUNT < 64, "Frame log ID masks need a bit for every reserved ID plus one");
+
+/**
+ * <b>Append-only writer for the chunked binary frame log.</b>
+ *
+ * Frames are packed into a RAM chunk; full chunks are written to storage in one write, each with a header that
+ * summarizes its time range and IDs. close() pads the last chunk, then writes the index and footer.
+ *
+ * The index is kept in RAM with at most MAX_INDEX_ENTRIES entries. When it fills up, neighbouring entries are merged
+ * and each entry starts covering twice as many chunks, so memory use is fixed no matter how long the session is.
+ *
+ * A chunk the storage takes none of, such as a LogSink that has fallen behind, is dropped and counted: it is left out
+ * of the file and the index, so the log only has a gap in time and stays readable. Any other short write breaks the
+ * chunk layout, so it fails the log.
+ *
+ * <code>
+ * FileStorage file("session.hflg", true);
+ * FrameLogWriter<FileStorage> log(file);
+ * log.begin();
+ * log.append(frame, timestampUs);
+ * log.close();
+ * </code>
+ * @tparam STORAGE any backend with write(const uint8_t*, size_t)
+ * @tparam CHUNK_SIZE the size of a chunk in bytes; defaults to 4096
+ * @tparam MAX_INDEX_ENTRIES the maximum number of index entries kept in RAM; must be even
+ */
+template <typename STORAGE, size_t CHUNK_SIZE = 4096, size_t MAX_INDEX_ENTRIES = 1024> class FrameLogWriter
+{
+    static_assert(CHUNK_SIZE >= FRAME_LOG_CHUNK_HEADER_SIZE + FRAME_LOG_RECORD_SIZE, "FrameLogWriter chunks must hold a record");
+    static_assert(CHUNK_SIZE <= 0xFFFFFFFF, "FrameLogWriter chunk size must fit the file header");
+    static_assert(MAX_INDEX_ENTRIES >= 2 && MAX_INDEX_ENTRIES % 2 == 0, "FrameLogWriter MAX_INDEX_ENTRIES must be even");
+
+public:
+    /** Number of records that fit in one chunk. */
+    static constexpr size_t RECORDS_PER_CHUNK = (CHUNK_SIZE - FRAME_LOG_CHUNK_HEADER_SIZE) / FRAME_LOG_RECORD_SIZE;
+
+    explicit FrameLogWriter(STORAGE& storage) : m_Storage(storage)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    FrameLogWriter(const FrameLogWriter&) = delete;
+    FrameLogWriter& operator=(const FrameLogWriter&) = delete;
+    FrameLogWriter(FrameLogWriter&&) = delete;
+    FrameLogWriter& operator=(FrameLogWriter&&) = delete;
+
+    /**
+     * <b>Write the file header.</b>
+     *
+     * @return false if the storage didn't accept the header, true otherwise
+     */
+    bool begin()
+    {
+        BufferPacker<FRAME_LOG_HEADER_SIZE> packer;
+        packer.pack(FRAME_LOG_MAGIC);
+        packer.pack(FRAME_LOG_VERSION);
+        packer.pack(static_cast<uint16_t>(0));
+        packer.pack(static_cast<uint32_t>(CHUNK_SIZE));
+        packer.pack(static_cast<uint32_t>(0));
+        uint8_t header[FRAME_LOG_HEADER_SIZE];
+        packer.deepCopyTo(header);
+        m_Failed = m_Storage.write(header, sizeof(header)) != sizeof(header);
+        return !m_Failed;
+    }
+
+    /**
+     * <b>Append a frame to the log.</b>
+     *
+     * Timestamps should be non-decreasing; a timestamp earlier than the first one in its chunk is recorded as the
+     * chunk's first timestamp.
+     *
+     * @param frame the frame to record
+     * @param timestampUs the frame's time in microseconds
+     * @return false if a storage write failed (now or earlier), true otherwise; a dropped chunk is not a failure
+     */
+    bool append(const CanFrame& frame, const uint64_t timestampUs)
+    {
+        if (m_Failed)
+        {
+            return false;
+        }
+        if (m_RecordCount == 0)
+        {
+            m_ChunkBaseUs = timestampUs;
+        }
+        const uint64_t recordedUs = timestampUs > m_ChunkBaseUs ? timestampUs : m_ChunkBaseUs;
+        const uint64_t delta = recordedUs - m_ChunkBaseUs;
+        if (delta > UINT32_MAX)
+        {
+            // Timestamp delta wouldn't fit - start a new chunk
+            flushChunk();
+            return append(frame, timestampUs);
+        }
+
+        BufferPacker<FRAME_LOG_RECORD_SIZE> packer;
+        packer.pack(static_cast<uint32_t>(delta));
+        packer.pack(frame.id);
+        packer.pack(frame.len);
+        packer.pack(static_cast<uint8_t>(frame.extended ? 1 : 0));
+        FrameLogPayload payload;
+        memcpy(payload.bytes, frame.buf, CAN_MAX_DLC);
+        packer.pack(payload);
+        uint8_t record[FRAME_LOG_RECORD_SIZE];
+        packer.deepCopyTo(record);
+        memcpy(&m_Chunk[FRAME_LOG_CHUNK_HEADER_SIZE + m_RecordCount * FRAME_LOG_RECORD_SIZE], record, sizeof(record));
+
+        m_ChunkSummary.add(recordedUs, frame.id);
+        if (++m_RecordCount == RECORDS_PER_CHUNK)
+        {
+            flushChunk();
+        }
+        return !m_Failed;
+    }
+
+    /**
+     * <b>Write the partially filled chunk, the index and the footer.</b>
+     *
+     * @return false if a storage write failed, true otherwise
+     */
+    bool close()
+    {
+        if (m_RecordCount > 0)
+        {
+            flushChunk();
+        }
+        for (size_t i = 0; i < m_EntryCount && !m_Failed; i++)
+        {
+            BufferPacker<FRAME_LOG_INDEX_ENTRY_SIZE> packer;
+            packer.pack(m_Index[i].firstUs);
+            packer.pack(m_Index[i].lastUs);
+            packer.pack(m_Index[i].idMask);
+            uint8_t entry[FRAME_LOG_INDEX_ENTRY_SIZE];
+            packer.deepCopyTo(entry);
+            m_Failed = m_Storage.write(entry, sizeof(entry)) != sizeof(entry);
+        }
+        BufferPacker<FRAME_LOG_FOOTER_SIZE> packer;
+        packer.pack(FRAME_LOG_INDEX_MAGIC);
+        packer.pack(m_ChunkCount);
+        packer.pack(static_cast<uint32_t>(m_EntryCount));
+        packer.pack(m_ChunksPerEntry);
+        uint8_t footer[FRAME_LOG_FOOTER_SIZE];
+        packer.deepCopyTo(footer);
+        if (!m_Failed)
+        {
+            m_Failed = m_Storage.write(footer, sizeof(footer)) != sizeof(footer);
+        }
+        return !m_Failed;
+    }
+
+    /** @return the number of chunks written so far */
+    [[nodiscard]] uint32_t getChunkCount() const
+    {
+        return m_ChunkCount;
+    }
+
+    /** @return the number of chunks each index entry covers */
+    [[nodiscard]] uint32_t getChunksPerEntry() const
+    {
+        return m_ChunksPerEntry;
+    }
+
+    /** @return the number of chunks left out of the log because the storage took none of them */
+    [[nodiscard]] uint32_t getDroppedChunkCount() const
+    {
+        return m_DroppedChunks;
+    }
+
+private:
+    /** Fill in the chunk header, write the chunk and account it in the index. */
+    void flushChunk()
+    {
+        BufferPacker<FRAME_LOG_CHUNK_HEADER_SIZE> packer;
+        packer.pack(FRAME_LOG_CHUNK_MAGIC);
+        packer.pack(static_cast<uint16_t>(m_RecordCount));
+        packer.pack(static_cast<uint16_t>(0));
+        packer.pack(m_ChunkSummary.firstUs);
+        packer.pack(m_ChunkSummary.lastUs);
+        packer.pack(m_ChunkSummary.idMask);
+        uint8_t header[FRAME_LOG_CHUNK_HEADER_SIZE];
+        packer.deepCopyTo(header);
+        memcpy(m_Chunk, header, sizeof(header));
+
+        // Zero the unused tail so a padded last chunk doesn't carry stale records
+        const size_t used = FRAME_LOG_CHUNK_HEADER_SIZE + m_RecordCount * FRAME_LOG_RECORD_SIZE;
+        memset(&m_Chunk[used], 0, CHUNK_SIZE - used);
+        if (!m_Failed)
+        {
+            const size_t written = m_Storage.write(m_Chunk, CHUNK_SIZE);
+            if (written == 0)
+            {
+                // Nothing reached the file, so leaving the chunk out keeps every chunk at its offset
+                m_DroppedChunks++;
+                m_RecordCount = 0;
+                m_ChunkSummary = FrameLogSummary{};
+                return;
+            }
+            m_Failed = written != CHUNK_SIZE;
+        }
+
+        if (m_ChunkCount % m_ChunksPerEntry == 0)
+        {
+            if (m_EntryCount == MAX_INDEX_ENTRIES)
+            {
+                // Index is full - merge pairs so each entry covers twice as many chunks
+                for (size_t i = 0; i < MAX_INDEX_ENTRIES / 2; i++)
+                {
+                    m_Index[i] = m_Index[2 * i];
+                    m_Index[i].merge(m_Index[2 * i + 1]);
+                }
+                m_EntryCount = MAX_INDEX_ENTRIES / 2;
+                m_ChunksPerEntry *= 2;
+            }
+            if (m_ChunkCount % m_ChunksPerEntry == 0)
+            {
+                m_Index[m_EntryCount++] = FrameLogSummary{};
+            }
+        }
+        m_Index[m_EntryCount - 1].merge(m_ChunkSummary);
+
+        m_ChunkCount++;
+        m_RecordCount = 0;
+        m_ChunkSummary = FrameLogSummary{};
+    }
+
+    /** Destination of the log. */
+    STORAGE& m_Storage;
+    /** Chunk being filled; the header is written in when the chunk is flushed. */
+    uint8_t m_Chunk[CHUNK_SIZE] = {};
+    /** Number of records in m_Chunk. */
+    size_t m_RecordCount = 0;
+    /** Timestamp, in microseconds, that record deltas in m_Chunk are relative to. */
+    uint64_t m_ChunkBaseUs = 0;
+    /** Summary of the records in m_Chunk. */
+    FrameLogSummary m_ChunkSummary;
+    /** Summaries of the chunks written so far. */
+    FrameLogSummary m_Index[MAX_INDEX_ENTRIES];
+    /** Number of used entries in m_Index. */
+    size_t m_EntryCount = 0;
+    /** Number of chunks each index entry covers. */
+    uint32_t m_ChunksPerEntry = 1;
+    /** Number of chunks written. */
+    uint32_t m_ChunkCount = 0;
+    /** Number of chunks the storage took none of. */
+    uint32_t m_DroppedChunks = 0;
+    /** Whether a storage write has failed. */
+    bool m_Failed = false;
+};
+
+/**
+ * <b>Random-access reader for the chunked binary frame log.</b>
+ *
+ * Queries walk the trailing index and only read chunks whose time range overlaps the query and whose ID mask contains
+ * a requested ID, so extracting a short window or a single ID from a large session touches a small part of the file.
+ * If the log was never closed (no footer), every chunk header is consulted instead, which still skips the records of
+ * non-matching chunks.
+ *
+ * <code>
+ * FileStorage file("session.hflg", false);
+ * FrameLogReader<FileStorage> log(file);
+ * log.open();
+ * log.query(startUs, endUs, frameLogIdBit(TireRPMId), [](const CanFrame& frame, uint64_t timestampUs) { ... });
+ * </code>
+ * @tparam STORAGE any backend with read(uint64_t, uint8_t*, size_t) and size()
+ * @tparam MAX_CHUNK_SIZE the largest chunk size the reader can buffer; defaults to 4096
+ */
+template <typename STORAGE, size_t MAX_CHUNK_SIZE = 4096> class FrameLogReader
+{
+public:
+    /** ID mask matching every ID. */
+    static constexpr uint64_t ALL_IDS = UINT64_MAX;
+
+    explicit FrameLogReader(STORAGE& storage) : m_Storage(storage)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    FrameLogReader(const FrameLogReader&) = delete;
+    FrameLogReader& operator=(const FrameLogReader&) = delete;
+    FrameLogReader(FrameLogReader&&) = delete;
+    FrameLogReader& operator=(FrameLogReader&&) = delete;
+
+    /**
+     * <b>Validate the file header and load the footer.</b>
+     *
+     * @return false if the file isn't a frame log or its chunks are larger than MAX_CHUNK_SIZE, true otherwise
+     */
+    bool open()
+    {
+        uint8_t header[FRAME_LOG_HEADER_SIZE];
+        if (m_Storage.read(0, header, sizeof(header)) != sizeof(header))
+        {
+            return false;
+        }
+        BufferPacker<FRAME_LOG_HEADER_SIZE> headerUnpacker(header);
+        const auto magic = headerUnpacker.unpack<uint32_t>();
+        const auto version = headerUnpacker.unpack<uint16_t>();
+        headerUnpacker.skip<uint16_t>();
+        m_ChunkSize = headerUnpacker.unpack<uint32_t>();
+        if (magic != FRAME_LOG_MAGIC || version != FRAME_LOG_VERSION || m_ChunkSize > MAX_CHUNK_SIZE ||
+            m_ChunkSize < FRAME_LOG_CHUNK_HEADER_SIZE)
+        {
+            return false;
+        }
+
+        const uint64_t fileSize = m_Storage.size();
+        uint8_t footer[FRAME_LOG_FOOTER_SIZE];
+        m_HasIndex = false;
+        if (fileSize >= FRAME_LOG_HEADER_SIZE + FRAME_LOG_FOOTER_SIZE &&
+            m_Storage.read(fileSize - FRAME_LOG_FOOTER_SIZE, footer, sizeof(footer)) == sizeof(footer))
+        {
+            BufferPacker<FRAME_LOG_FOOTER_SIZE> footerUnpacker(footer);
+            const auto footerMagic = footerUnpacker.unpack<uint32_t>();
+            m_ChunkCount = footerUnpacker.unpack<uint32_t>();
+            m_EntryCount = footerUnpacker.unpack<uint32_t>();
+            m_ChunksPerEntry = footerUnpacker.unpack<uint32_t>();
+            m_IndexOffset = FRAME_LOG_HEADER_SIZE + static_cast<uint64_t>(m_ChunkCount) * m_ChunkSize;
+            m_HasIndex = footerMagic == FRAME_LOG_INDEX_MAGIC && m_ChunksPerEntry > 0 &&
+                m_IndexOffset + static_cast<uint64_t>(m_EntryCount) * FRAME_LOG_INDEX_ENTRY_SIZE + FRAME_LOG_FOOTER_SIZE == fileSize;
+        }
+        if (!m_HasIndex)
+        {
+            // Unclosed log - every complete chunk is still usable
+            m_ChunkCount = static_cast<uint32_t>((fileSize - FRAME_LOG_HEADER_SIZE) / m_ChunkSize);
+            m_EntryCount = m_ChunkCount;
+            m_ChunksPerEntry = 1;
+        }
+        return true;
+    }
+
+    /**
+     * <b>Hand every frame in a time window whose ID is in idMask to a handler.</b>
+     *
+     * @tparam HANDLER any callable taking (const CanFrame&, uint64_t timestampUs)
+     * @param startUs the start of the window in microseconds, inclusive
+     * @param endUs the end of the window in microseconds, inclusive
+     * @param idMask OR of frameLogIdBit() for the wanted IDs; ALL_IDS for every ID
+     * @param handler the callable invoked for every matching frame, in log order
+     * @return The number of frames handed to handler
+     */
+    template <typename HANDLER>
+    size_t query(const uint64_t startUs, const uint64_t endUs, const uint64_t idMask, HANDLER&& handler)
+    {
+        size_t matched = 0;
+        m_ChunksRead = 0;
+        for (uint32_t entry = firstEntryEndingAfter(startUs); entry < m_EntryCount; entry++)
+        {
+            FrameLogSummary summary;
+            if (!readEntry(entry, summary))
+            {
+                break;
+            }
+            if (summary.firstUs > endUs && summary.firstUs != UINT64_MAX)
+            {
+                break;
+            }
+            if (!summary.matches(startUs, endUs, idMask))
+            {
+                continue;
+            }
+            const uint32_t firstChunk = entry * m_ChunksPerEntry;
+            for (uint32_t chunk = firstChunk; chunk < firstChunk + m_ChunksPerEntry && chunk < m_ChunkCount; chunk++)
+            {
+                matched += readChunk(chunk, startUs, endUs, idMask, handler);
+            }
+        }
+        return matched;
+    }
+
+    /** @return the number of chunks in the log */
+    [[nodiscard]] uint32_t getChunkCount() const
+    {
+        return m_ChunkCount;
+    }
+
+    /** @return whether the log has a trailing index (was closed properly) */
+    [[nodiscard]] bool hasIndex() const
+    {
+        return m_HasIndex;
+    }
+
+    /** @return the number of chunks whose records the last query() had to read */
+    [[nodiscard]] uint32_t getChunksRead() const
+    {
+        return m_ChunksRead;
+    }
+
+private:
+    /** Read index entry n, or the header of chunk n when there is no index. */
+    bool readEntry(const uint32_t entry, FrameLogSummary& summary)
+    {
+        if (!m_HasIndex)
+        {
+            uint16_t records;
+            return readChunkHeader(entry, summary, records);
+        }
+        uint8_t buffer[FRAME_LOG_INDEX_ENTRY_SIZE];
+        if (m_Storage.read(m_IndexOffset + static_cast<uint64_t>(entry) * FRAME_LOG_INDEX_ENTRY_SIZE, buffer, sizeof(buffer)) != sizeof(buffer))
+        {
+            return false;
+        }
+        BufferPacker<FRAME_LOG_INDEX_ENTRY_SIZE> unpacker(buffer);
+        summary.firstUs = unpacker.unpack<uint64_t>();
+        summary.lastUs = unpacker.unpack<uint64_t>();
+        summary.idMask = unpacker.unpack<uint64_t>();
+        return true;
+    }
+
+    bool readChunkHeader(const uint32_t chunk, FrameLogSummary& summary, uint16_t& records)
+    {
+        uint8_t buffer[FRAME_LOG_CHUNK_HEADER_SIZE];
+        if (m_Storage.read(chunkOffset(chunk), buffer, sizeof(buffer)) != sizeof(buffer))
+        {
+            return false;
+        }
+        BufferPacker<FRAME_LOG_CHUNK_HEADER_SIZE> unpacker(buffer);
+        const auto magic = unpacker.unpack<uint32_t>();
+        records = unpacker.unpack<uint16_t>();
+        unpacker.skip<uint16_t>();
+        summary.firstUs = unpacker.unpack<uint64_t>();
+        summary.lastUs = unpacker.unpack<uint64_t>();
+        summary.idMask = unpacker.unpack<uint64_t>();
+        return magic == FRAME_LOG_CHUNK_MAGIC;
+    }
+
+    /** Binary search for the first entry whose time range ends at or after startUs. */
+    uint32_t firstEntryEndingAfter(const uint64_t startUs)
+    {
+        uint32_t low = 0;
+        uint32_t high = m_EntryCount;
+        while (low < high)
+        {
+            const uint32_t middle = low + (high - low) / 2;
+            FrameLogSummary summary;
+            if (readEntry(middle, summary) && summary.lastUs < startUs)
+            {
+                low = middle + 1;
+            } else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    template <typename HANDLER>
+    size_t readChunk(const uint32_t chunk, const uint64_t startUs, const uint64_t endUs, const uint64_t idMask, HANDLER& handler)
+    {
+        FrameLogSummary summary;
+        uint16_t records = 0;
+        if (!readChunkHeader(chunk, summary, records) || !summary.matches(startUs, endUs, idMask))
+        {
+            return 0;
+        }
+        const size_t bytes = FRAME_LOG_CHUNK_HEADER_SIZE + static_cast<size_t>(records) * FRAME_LOG_RECORD_SIZE;
+        if (bytes > m_ChunkSize || m_Storage.read(chunkOffset(chunk), m_Chunk, bytes) != bytes)
+        {
+            return 0;
+        }
+        m_ChunksRead++;
+
+        size_t matched = 0;
+        for (size_t i = 0; i < records; i++)
+        {
+            BufferPacker<FRAME_LOG_RECORD_SIZE> unpacker(&m_Chunk[FRAME_LOG_CHUNK_HEADER_SIZE + i * FRAME_LOG_RECORD_SIZE], FRAME_LOG_RECORD_SIZE);
+            const uint64_t timestampUs = summary.firstUs + unpacker.unpack<uint32_t>();
+            CanFrame frame;
+            frame.id = unpacker.unpack<uint32_t>();
+            if (timestampUs < startUs || timestampUs > endUs || (frameLogIdBit(frame.id) & idMask) == 0)
+            {
+                continue;
+            }
+            frame.len = unpacker.unpack<uint8_t>();
+            frame.extended = (unpacker.unpack<uint8_t>() & 1) != 0;
+            const auto data = unpacker.unpack<FrameLogPayload>();
+            memcpy(frame.buf, data.bytes, CAN_MAX_DLC);
+            frame.timestamp = static_cast<uint32_t>(timestampUs);
+            handler(static_cast<const CanFrame&>(frame), timestampUs);
+            matched++;
+        }
+        return matched;
+    }
+
+    uint64_t chunkOffset(const uint32_t chunk) const
+    {
+        return FRAME_LOG_HEADER_SIZE + static_cast<uint64_t>(chunk) * m_ChunkSize;
+    }
+
+    /** Source of the log. */
+    STORAGE& m_Storage;
+    /** Chunk size from the file header. */
+    uint32_t m_ChunkSize = 0;
+    /** Number of chunks in the log. */
+    uint32_t m_ChunkCount = 0;
+    /** Number of index entries, or of chunks when there is no index. */
+    uint32_t m_EntryCount = 0;
+    /** Number of chunks each index entry covers. */
+    uint32_t m_ChunksPerEntry = 1;
+    /** Offset of the first index entry. */
+    uint64_t m_IndexOffset = 0;
+    /** Whether the log has a valid trailing index. */
+    bool m_HasIndex = false;
+    /** Chunks read by the last query(). */
+    uint32_t m_ChunksRead = 0;
+    /** Buffer for the records of one chunk. */
+    uint8_t m_Chunk[MAX_CHUNK_SIZE] = {};
+};
+
+#endif //FRAMELOG_H
@@ -0,0 +1,221 @@
+#ifndef FRAMERING_H
+#define FRAMERING_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+
+/** Size of a data cache line; the Teensy 4.1's Cortex-M7 uses 32-byte lines, most hosts use 64. */
+#if defined(__arm__)
+constexpr size_t CACHE_LINE_SIZE = 32;
+#else
+constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+
+/**
+ * <b>Lock-free single-producer/single-consumer ring of fixed-size frames.</b>
+ *
+ * Intended to hand frames from an interrupt (the producer) to loop() (the consumer) without disabling interrupts.
+ * The producer only copies a frame into a slot and bumps its index; everything else happens on the consumer side.
+ *
+ * The producer and consumer indices live on separate cache lines so the two sides never contend for the same line.
+ * Indices are free-running and masked on access, which is why CAPACITY <b>MUST</b> be a power of two.
+ *
+ * <code>
+ * FrameRing<64> rxRing;
+ *
+ * void canIsr(const CanFrame& frame) { rxRing.push(frame); }
+ *
+ * void loop() { rxRing.drain([](const CanFrame& frame) { handle(frame); }); }
+ * </code>
+ * @tparam CAPACITY the number of frame slots; must be a power of two
+ * @tparam FRAME any type that can be copied safely with c-style memcpy; defaults to CanFrame
+ */
+template <size_t CAPACITY, typename FRAME = CanFrame> class FrameRing
+{
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "FrameRing CAPACITY must be a power of two");
+    static_assert(CAPACITY <= 0x80000000u, "FrameRing CAPACITY must fit in the 32-bit index space");
+
+public:
+    FrameRing() : m_Head(0), m_Drops(0), m_HighWaterMark(0), m_Tail(0)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    FrameRing(const FrameRing&) = delete;
+    FrameRing& operator=(const FrameRing&) = delete;
+    FrameRing(FrameRing&&) = delete;
+    FrameRing& operator=(FrameRing&&) = delete;
+
+    /**
+     * <b>Producer side: copy a frame into the ring.</b>
+     *
+     * When the ring is full the frame is dropped and the drop counter is incremented.
+     *
+     * @param frame the frame to copy into the next free slot
+     * @return false if the ring was full and the frame was dropped, true otherwise
+     */
+    bool push(const FRAME& frame)
+    {
+        FRAME* slot = acquire();
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        *slot = frame;
+        commit();
+        return true;
+    }
+
+    /**
+     * <b>Producer side: reserve the next free slot so it can be filled in place.</b>
+     *
+     * The slot is not visible to the consumer until commit() is called. When the ring is full nothing is reserved
+     * and the drop counter is incremented.
+     *
+     * @return A pointer to the reserved slot; nullptr if the ring is full
+     */
+    FRAME* acquire()
+    {
+        const uint32_t head = m_Head.load(std::memory_order_relaxed);
+        const uint32_t tail = m_Tail.load(std::memory_order_acquire);
+        if (head - tail >= CAPACITY)
+        {
+            // Ring is full - count the drop, only the producer writes this counter
+            m_Drops.store(m_Drops.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &m_Slots[head & MASK];
+    }
+
+    /** <b>Producer side: publish the slot reserved by the last successful acquire().</b> */
+    void commit()
+    {
+        const uint32_t head = m_Head.load(std::memory_order_relaxed) + 1;
+        const uint32_t used = head - m_Tail.load(std::memory_order_relaxed);
+        if (used > m_HighWaterMark.load(std::memory_order_relaxed))
+        {
+            m_HighWaterMark.store(used, std::memory_order_relaxed);
+        }
+        m_Head.store(head, std::memory_order_release);
+    }
+
+    /**
+     * <b>Consumer side: copy the oldest frame out of the ring.</b>
+     *
+     * @param frame the frame to copy the oldest entry into; untouched if the ring is empty
+     * @return false if the ring was empty, true otherwise
+     */
+    bool pop(FRAME& frame)
+    {
+        const uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail == m_Head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        frame = m_Slots[tail & MASK];
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * <b>Consumer side: copy up to maxFrames of the oldest frames out of the ring at once.</b>
+     *
+     * The consumer index is only published once for the whole batch.
+     *
+     * @param dest the array to copy frames into
+     * @param maxFrames the number of frames dest can hold
+     * @return The number of frames copied into dest
+     */
+    size_t drain(FRAME* dest, const size_t maxFrames)
+    {
+        const uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t count = clampAvailable(tail, maxFrames);
+        for (size_t i = 0; i < count; i++)
+        {
+            dest[i] = m_Slots[(tail + i) & MASK];
+        }
+        m_Tail.store(tail + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * <b>Consumer side: hand up to maxFrames of the oldest frames to a handler, in place.</b>
+     *
+     * The handler sees each frame in its slot without a copy, so it must not keep a reference to it after returning.
+     * The consumer index is only published once for the whole batch.
+     *
+     * @tparam HANDLER any callable taking a const FRAME&
+     * @param handler the callable invoked once per frame, oldest first
+     * @param maxFrames the maximum number of frames to hand over; defaults to the whole ring
+     * @return The number of frames handed to handler
+     */
+    template <typename HANDLER> size_t drain(HANDLER&& handler, const size_t maxFrames = CAPACITY)
+    {
+        const uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t count = clampAvailable(tail, maxFrames);
+        for (size_t i = 0; i < count; i++)
+        {
+            handler(static_cast<const FRAME&>(m_Slots[(tail + i) & MASK]));
+        }
+        m_Tail.store(tail + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    /** @return the number of frames currently waiting in the ring */
+    [[nodiscard]] size_t size() const
+    {
+        return m_Head.load(std::memory_order_acquire) - m_Tail.load(std::memory_order_acquire);
+    }
+
+    /** @return true if there are no frames waiting in the ring */
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /** @return the number of frame slots in the ring */
+    [[nodiscard]] static constexpr size_t capacity()
+    {
+        return CAPACITY;
+    }
+
+    /** @return the number of frames dropped by the producer because the ring was full */
+    [[nodiscard]] uint32_t getDropCount() const
+    {
+        return m_Drops.load(std::memory_order_relaxed);
+    }
+
+    /** @return the largest number of frames that have been waiting in the ring at once */
+    [[nodiscard]] uint32_t getHighWaterMark() const
+    {
+        return m_HighWaterMark.load(std::memory_order_relaxed);
+    }
+
+private:
+    /** Mask that turns a free-running index into a slot index. */
+    static constexpr uint32_t MASK = static_cast<uint32_t>(CAPACITY - 1);
+
+    /** @return the number of frames the consumer can take starting at tail, limited to maxFrames */
+    size_t clampAvailable(const uint32_t tail, const size_t maxFrames) const
+    {
+        const size_t available = m_Head.load(std::memory_order_acquire) - tail;
+        return available < maxFrames ? available : maxFrames;
+    }
+
+    /** Free-running producer index; written only by the producer. */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_Head;
+    /** Number of frames dropped on a full ring; written only by the producer. */
+    std::atomic<uint32_t> m_Drops;
+    /** Largest observed fill level; written only by the producer. */
+    std::atomic<uint32_t> m_HighWaterMark;
+    /** Free-running consumer index; written only by the consumer. */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_Tail;
+    /** Frame storage, starting on its own cache line. */
+    alignas(CACHE_LINE_SIZE) FRAME m_Slots[CAPACITY] = {};
+};
+
+#endif //FRAMERING_H
@@ -0,0 +1,218 @@
+#ifndef HEALTHCHECK_H
+#define HEALTHCHECK_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/** Number of health-check responders (DCFId, DCRId, DCTId). */
+constexpr size_t HEALTH_RESPONDER_COUNT = DCTId - DCFId + 1;
+
+/** Round-trip latency statistics of a single health-check responder. */
+template <size_t HISTOGRAM_BUCKETS> struct HealthLatencyStats
+{
+    /** Number of responses matched to a request. */
+    uint32_t responses = 0;
+    /** Number of requests the responder didn't answer in time. */
+    uint32_t timeouts = 0;
+    /** Smallest round-trip latency seen, in microseconds. */
+    uint32_t minUs = UINT32_MAX;
+    /** Largest round-trip latency seen, in microseconds. */
+    uint32_t maxUs = 0;
+    /** Sum of all round-trip latencies, in microseconds; divide by responses for the mean. */
+    uint64_t totalUs = 0;
+    /** Bucket n counts latencies in [2^n, 2^(n+1)) microseconds; the last bucket also holds everything larger. */
+    uint32_t histogram[HISTOGRAM_BUCKETS] = {};
+};
+
+/**
+ * <b>Round-trip latency tracker for the HealthCheckId probe and its DCFId / DCRId / DCTId responses.</b>
+ *
+ * Every outgoing HealthCheckId frame carries a uint16_t sequence number and the uint32_t send timestamp in
+ * microseconds. Responders are expected to echo that 6-byte payload back under their own ID.
+ *
+ * Outstanding requests live in a power-of-two window indexed by sequence number, so matching a response is a single
+ * array access. Each window entry keeps a bitmask of the responders that still owe an answer; a request that isn't
+ * fully answered within the timeout counts a timeout against each missing responder.
+ *
+ * <code>
+ * HealthCheckClient<> health(50000);   // 50 ms timeout
+ * health.sendRequest(micros(), frame); can.write(frame);
+ * ...
+ * health.handleResponse(rxFrame, micros());
+ * health.poll(micros());
+ * </code>
+ * @tparam WINDOW the maximum number of outstanding requests; must be a power of two
+ * @tparam HISTOGRAM_BUCKETS the number of power-of-two latency buckets per responder; defaults to 16 (up to ~32 ms)
+ */
+template <size_t WINDOW = 16, size_t HISTOGRAM_BUCKETS = 16> class HealthCheckClient
+{
+    static_assert(WINDOW > 0 && (WINDOW & (WINDOW - 1)) == 0, "HealthCheckClient WINDOW must be a power of two");
+    static_assert(WINDOW <= 0x8000, "HealthCheckClient WINDOW must be smaller than the sequence number space");
+    static_assert(HISTOGRAM_BUCKETS > 0 && HISTOGRAM_BUCKETS <= 32, "HealthCheckClient supports 1 to 32 buckets");
+
+public:
+    /** Latency statistics type kept for each responder. */
+    using Stats = HealthLatencyStats<HISTOGRAM_BUCKETS>;
+
+    /** @param timeoutUs how long, in microseconds, a responder has to answer a request */
+    explicit HealthCheckClient(const uint32_t timeoutUs) : m_TimeoutUs(timeoutUs)
+    {
+    }
+
+    /**
+     * <b>Stamp and pack the next HealthCheckId request.</b>
+     *
+     * If the window is full, the oldest outstanding request is given up on and counted as a timeout.
+     *
+     * @param nowUs the current time in microseconds
+     * @param frame the frame to pack the request into
+     * @return false if packing failed, true otherwise
+     */
+    bool sendRequest(const uint32_t nowUs, CanFrame& frame)
+    {
+        if (static_cast<uint16_t>(m_NextSeq - m_OldestSeq) >= WINDOW)
+        {
+            retireOldest();
+        }
+        const uint16_t seq = m_NextSeq++;
+        Pending& pending = m_Window[seq & MASK];
+        pending.seq = seq;
+        pending.sentUs = nowUs;
+        pending.waiting = ALL_RESPONDERS;
+
+        BufferPacker<sizeof(uint16_t) + sizeof(uint32_t)> packer;
+        packer.pack(seq);
+        packer.pack(nowUs);
+        return frame.pack(HealthCheckId, packer);
+    }
+
+    /**
+     * <b>Match a DCFId, DCRId or DCTId response to its request.</b>
+     *
+     * @param frame the received frame
+     * @param nowUs the current time in microseconds
+     * @return true if the frame answered an outstanding request, false otherwise (wrong ID, late or duplicate)
+     */
+    bool handleResponse(const CanFrame& frame, const uint32_t nowUs)
+    {
+        if (frame.id < DCFId || frame.id > DCTId)
+        {
+            return false;
+        }
+        const size_t responder = frame.id - DCFId;
+        auto unpacker = frame.unpacker();
+        const auto seq = unpacker.unpack<uint16_t>();
+        if (!unpacker)
+        {
+            m_Unmatched++;
+            return false;
+        }
+
+        Pending& pending = m_Window[seq & MASK];
+        const uint8_t bit = static_cast<uint8_t>(1u << responder);
+        const bool outstanding = static_cast<uint16_t>(seq - m_OldestSeq) < static_cast<uint16_t>(m_NextSeq - m_OldestSeq);
+        if (!outstanding || pending.seq != seq || !(pending.waiting & bit))
+        {
+            m_Unmatched++;
+            return false;
+        }
+        pending.waiting &= static_cast<uint8_t>(~bit);
+        record(m_Stats[responder], nowUs - pending.sentUs);
+        return true;
+    }
+
+    /**
+     * <b>Retire requests that are fully answered or have timed out.</b>
+     *
+     * Only looks at the oldest outstanding requests, so a call costs O(1) amortized.
+     *
+     * @param nowUs the current time in microseconds
+     */
+    void poll(const uint32_t nowUs)
+    {
+        while (m_OldestSeq != m_NextSeq)
+        {
+            const Pending& pending = m_Window[m_OldestSeq & MASK];
+            if (pending.waiting != 0 && nowUs - pending.sentUs < m_TimeoutUs)
+            {
+                break;
+            }
+            retireOldest();
+        }
+    }
+
+    /** @return the statistics of a responder; responder must be DCFId, DCRId or DCTId */
+    [[nodiscard]] const Stats& getStats(const ReservedIDs responder) const
+    {
+        return m_Stats[responder >= DCFId && responder <= DCTId ? responder - DCFId : 0];
+    }
+
+    /** @return the number of requests that poll() hasn't retired yet */
+    [[nodiscard]] size_t getOutstanding() const
+    {
+        return static_cast<uint16_t>(m_NextSeq - m_OldestSeq);
+    }
+
+    /** @return the number of responses that didn't match an outstanding request */
+    [[nodiscard]] uint32_t getUnmatchedCount() const
+    {
+        return m_Unmatched;
+    }
+
+private:
+    /** An outstanding request. */
+    struct Pending
+    {
+        uint16_t seq;
+        uint32_t sentUs;
+        /** Bit n is set while responder DCFId + n still owes an answer. */
+        uint8_t waiting;
+    };
+
+    /** Mask that turns a sequence number into a window index. */
+    static constexpr uint16_t MASK = static_cast<uint16_t>(WINDOW - 1);
+    /** Waiting mask with every responder set. */
+    static constexpr uint8_t ALL_RESPONDERS = static_cast<uint8_t>((1u << HEALTH_RESPONDER_COUNT) - 1);
+
+    /** Drop the oldest request, counting a timeout for every responder that didn't answer it. */
+    void retireOldest()
+    {
+        const Pending& pending = m_Window[m_OldestSeq & MASK];
+        for (size_t responder = 0; responder < HEALTH_RESPONDER_COUNT; responder++)
+        {
+            if (pending.waiting & (1u << responder))
+            {
+                m_Stats[responder].timeouts++;
+            }
+        }
+        m_OldestSeq++;
+    }
+
+    static void record(Stats& stats, const uint32_t latencyUs)
+    {
+        stats.responses++;
+        stats.totalUs += latencyUs;
+        stats.minUs = latencyUs < stats.minUs ? latencyUs : stats.minUs;
+        stats.maxUs = latencyUs > stats.maxUs ? latencyUs : stats.maxUs;
+        const size_t bucket = latencyUs < 2 ? 0 : static_cast<size_t>(31 - __builtin_clz(latencyUs));
+        stats.histogram[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1]++;
+    }
+
+    /** How long, in microseconds, a responder has to answer. */
+    uint32_t m_TimeoutUs;
+    /** Sequence number of the next request. */
+    uint16_t m_NextSeq = 0;
+    /** Sequence number of the oldest outstanding request; equal to m_NextSeq when none are outstanding. */
+    uint16_t m_OldestSeq = 0;
+    /** Outstanding requests, indexed by sequence number. */
+    Pending m_Window[WINDOW] = {};
+    /** Statistics per responder, indexed by ID - DCFId. */
+    Stats m_Stats[HEALTH_RESPONDER_COUNT];
+    /** Responses that didn't match an outstanding request. */
+    uint32_t m_Unmatched = 0;
+};
+
+#endif //HEALTHCHECK_H
@@ -0,0 +1,248 @@
+#ifndef LOGSINK_H
+#define LOGSINK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "BufferPacker.h"
+#include "FrameRing.h"
+
+/** Latency and loss counters kept by a LogSink. */
+struct LogSinkStats
+{
+    /** Buffers written to storage. */
+    uint32_t flushes = 0;
+    /** Duration of the most recent storage write, in microseconds. */
+    uint32_t lastFlushUs = 0;
+    /** Longest storage write, in microseconds. */
+    uint32_t maxFlushUs = 0;
+    /** Sum of all storage write durations, in microseconds; divide by flushes for the mean. */
+    uint64_t totalFlushUs = 0;
+    /** Storage writes that didn't take the whole buffer. */
+    uint32_t writeErrors = 0;
+};
+
+/**
+ * <b>Double-buffered, non-blocking sink in front of a slow storage backend such as an SD card.</b>
+ *
+ * The control loop writes records into the active RAM buffer, which is a plain memcpy. When the active buffer fills
+ * up it is handed off for flushing and writing continues in the other buffer. service() writes handed-off buffers to
+ * storage and can be called from wherever blocking is acceptable: idle time in loop(), a low-priority interrupt, or a
+ * second thread on the host.
+ *
+ * write() never waits for storage. If a record doesn't fit in the free buffer space because storage has fallen
+ * behind, the whole record is dropped and counted instead.
+ *
+ * The sink itself provides write(const uint8_t*, size_t), so it can sit between FrameLogWriter and its storage. A
+ * chunk the sink drops is left out of the log and counted by FrameLogWriter::getDroppedChunkCount(), and the log
+ * keeps going.
+ * write()/append()/sync() may run in one context and service() in another, like FrameRing's producer and consumer.
+ *
+ * <code>
+ * FileStorage file("session.hflg", true);
+ * LogSink<FileStorage> sink(file, micros);
+ * FrameLogWriter<LogSink<FileStorage>> log(sink);
+ * log.append(frame, micros());   // control loop
+ * sink.service();                // idle time
+ * </code>
+ * @tparam STORAGE any backend with write(const uint8_t*, size_t)
+ * @tparam BUFFER_SIZE the size of each of the two buffers in bytes; a multiple of the 512-byte SD sector
+ */
+template <typename STORAGE, size_t BUFFER_SIZE = 16384> class LogSink
+{
+    static_assert(BUFFER_SIZE > 0 && BUFFER_SIZE % 512 == 0, "LogSink BUFFER_SIZE must be a multiple of 512 bytes");
+
+public:
+    /** Returns the current time in microseconds; Arduino's micros() fits. */
+    using Clock = uint32_t (*)();
+
+    /**
+     * @param storage the backend handed-off buffers are written to
+     * @param clock the function used to time storage writes
+     */
+    LogSink(STORAGE& storage, const Clock clock) : m_Storage(storage), m_Clock(clock)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    LogSink(const LogSink&) = delete;
+    LogSink& operator=(const LogSink&) = delete;
+    LogSink(LogSink&&) = delete;
+    LogSink& operator=(LogSink&&) = delete;
+
+    /**
+     * <b>Copy a record into the buffers without blocking.</b>
+     *
+     * @param data the record bytes
+     * @param size the length of the record
+     * @return size if the record was buffered, 0 if it was dropped
+     */
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        const bool otherFree = m_Pending[m_Active ^ 1].load(std::memory_order_acquire) == 0;
+        if (size > BUFFER_SIZE - m_Fill + (otherFree ? BUFFER_SIZE : 0))
+        {
+            m_Drops++;
+            m_DroppedBytes += size;
+            return 0;
+        }
+
+        const size_t first = size < BUFFER_SIZE - m_Fill ? size : BUFFER_SIZE - m_Fill;
+        memcpy(&m_Buffers[m_Active][m_Fill], data, first);
+        m_Fill += first;
+        if (m_Fill == BUFFER_SIZE && otherFree)
+        {
+            handOff();
+            memcpy(m_Buffers[m_Active], data + first, size - first);
+            m_Fill = size - first;
+        }
+
+        const size_t buffered = m_Fill + m_Pending[m_Active ^ 1].load(std::memory_order_relaxed);
+        m_HighWaterMark = buffered > m_HighWaterMark ? buffered : m_HighWaterMark;
+        return size;
+    }
+
+    /**
+     * <b>Copy the packed bytes of a BufferPacker into the buffers without blocking.</b>
+     *
+     * @param record a BufferPacker in 'PACK' mode
+     * @return false if the record failed to pack or was dropped, true otherwise
+     */
+    template <size_t SIZE> bool append(BufferPacker<SIZE>& record)
+    {
+        uint8_t bytes[SIZE] = {};
+        record.deepCopyTo(bytes);
+        if (!record)
+        {
+            return false;
+        }
+        return write(bytes, record.getBufferSize()) == record.getBufferSize();
+    }
+
+    /**
+     * <b>Hand off the partially filled active buffer, so the next service() call writes it.</b>
+     *
+     * Call this periodically so a quiet log still reaches storage, and before close.
+     *
+     * @return false if the other buffer is still waiting to be written, true otherwise
+     */
+    bool sync()
+    {
+        if (m_Fill == 0)
+        {
+            return true;
+        }
+        if (m_Pending[m_Active ^ 1].load(std::memory_order_acquire) != 0)
+        {
+            return false;
+        }
+        handOff();
+        return true;
+    }
+
+    /**
+     * <b>Write a handed-off buffer to storage.</b>
+     *
+     * This is the only method that blocks on storage.
+     *
+     * @return The number of bytes written; 0 if no buffer was waiting
+     */
+    size_t service()
+    {
+        for (size_t i = 0; i < 2; i++)
+        {
+            const size_t size = m_Pending[i].load(std::memory_order_acquire);
+            if (size == 0)
+            {
+                continue;
+            }
+            const uint32_t start = m_Clock();
+            const size_t written = m_Storage.write(m_Buffers[i], size);
+            const uint32_t elapsed = m_Clock() - start;
+
+            m_Stats.flushes++;
+            m_Stats.lastFlushUs = elapsed;
+            m_Stats.maxFlushUs = elapsed > m_Stats.maxFlushUs ? elapsed : m_Stats.maxFlushUs;
+            m_Stats.totalFlushUs += elapsed;
+            if (written != size)
+            {
+                m_Stats.writeErrors++;
+            }
+            m_Pending[i].store(0, std::memory_order_release);
+            return size;
+        }
+        return 0;
+    }
+
+    /**
+     * <b>Write everything buffered to storage.</b>
+     *
+     * Blocks on storage; only call this from a single context, e.g. when shutting down.
+     */
+    void flush()
+    {
+        service();
+        sync();
+        service();
+    }
+
+    /** @return the largest number of bytes buffered at once */
+    [[nodiscard]] size_t getHighWaterMark() const
+    {
+        return m_HighWaterMark;
+    }
+
+    /** @return the number of records dropped because both buffers were full */
+    [[nodiscard]] uint32_t getDropCount() const
+    {
+        return m_Drops;
+    }
+
+    /** @return the number of bytes dropped because both buffers were full */
+    [[nodiscard]] uint64_t getDroppedBytes() const
+    {
+        return m_DroppedBytes;
+    }
+
+    /** @return the flush latency and error counters, updated by service() */
+    [[nodiscard]] const LogSinkStats& getStats() const
+    {
+        return m_Stats;
+    }
+
+private:
+    /** Publish the active buffer to service() and switch to the other one, which must be free. */
+    void handOff()
+    {
+        m_Pending[m_Active].store(m_Fill, std::memory_order_release);
+        m_Active ^= 1;
+        m_Fill = 0;
+    }
+
+    /** The two buffers, aligned for DMA and cache maintenance. */
+    alignas(CACHE_LINE_SIZE) uint8_t m_Buffers[2][BUFFER_SIZE] = {};
+    /** Bytes waiting to be written from each buffer; 0 while the buffer belongs to the writer. */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_Pending[2] = {};
+    /** Backend handed-off buffers are written to. */
+    STORAGE& m_Storage;
+    /** Function used to time storage writes. */
+    Clock m_Clock;
+    /** Flush counters, written by service(). */
+    LogSinkStats m_Stats;
+
+    /** Index of the buffer write() copies into. */
+    alignas(CACHE_LINE_SIZE) size_t m_Active = 0;
+    /** Bytes used in the active buffer. */
+    size_t m_Fill = 0;
+    /** Largest number of bytes buffered at once. */
+    size_t m_HighWaterMark = 0;
+    /** Records dropped because both buffers were full. */
+    uint32_t m_Drops = 0;
+    /** Bytes dropped because both buffers were full. */
+    uint64_t m_DroppedBytes = 0;
+};
+
+#endif //LOGSINK_H
@@ -0,0 +1,289 @@
+#ifndef MESSAGEBUS_H
+#define MESSAGEBUS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+#include "CanFrame.h"
+#include "MessageCodecs.h"
+#include "Reserved.h"
+
+/** Execution-time counters kept for every handler on a MessageBus. */
+struct MessageHandlerStats
+{
+    /** Times the handler was called. */
+    uint32_t calls = 0;
+    /** Duration of the most recent call, in clock ticks. */
+    uint32_t lastTicks = 0;
+    /** Longest call, in clock ticks. */
+    uint32_t maxTicks = 0;
+    /** Sum of all call durations, in clock ticks; divide by calls for the mean. */
+    uint64_t totalTicks = 0;
+};
+
+/**
+ * <b>Zero-allocation publish/subscribe dispatch of received frames, keyed by ReservedIDs.</b>
+ *
+ * Handlers subscribe to an ID once, at boot. Subscriptions are kept sorted by the ID's dense index in one flat array,
+ * with an offset table pointing at each ID's range, so publish() is an index lookup followed by a linear walk over
+ * that ID's handlers. Nothing is allocated and nothing is virtual; every handler is a plain function pointer with a
+ * context pointer.
+ *
+ * Handlers either take the raw frame, or the message struct from MessageCodecs.h. A frame is decoded at most once
+ * per publish(), into a scratch buffer inside the bus, no matter how many typed handlers it has.
+ *
+ * <code>
+ * MessageBus<> bus(micros);
+ * bus.subscribe<CurrentInfoMessage>(onCurrent, &stats);
+ * bus.subscribe(RVCId, onRvc, &vehicleState);
+ * rxRing.drain([&](const CanFrame& frame) { bus.publish(frame); });
+ * </code>
+ * @tparam MAX_HANDLERS the maximum number of subscriptions over all IDs
+ * @tparam SCRATCH_SIZE the size of the decode buffer; must hold the largest subscribed message struct
+ */
+template <size_t MAX_HANDLERS = 32, size_t SCRATCH_SIZE = 32> class MessageBus
+{
+public:
+    /** Returns the current time in ticks, e.g. Arduino's micros() or a cycle counter read. */
+    using Clock = uint32_t (*)();
+
+    /** Handler for the raw frame. */
+    using FrameHandler = void (*)(const CanFrame& frame, void* context);
+
+    /** Handler for a decoded message struct. */
+    template <typename MESSAGE> using MessageHandler = void (*)(const MESSAGE& message, void* context);
+
+    /** Returned by subscribe() if the subscription failed. */
+    static constexpr size_t INVALID_HANDLER = MAX_HANDLERS;
+
+    /**
+     * @param clock the function used to time handlers; nullptr disables the execution-time counters
+     */
+    explicit MessageBus(const Clock clock = nullptr) : m_Clock(clock)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    MessageBus(const MessageBus&) = delete;
+    MessageBus& operator=(const MessageBus&) = delete;
+    MessageBus(MessageBus&&) = delete;
+    MessageBus& operator=(MessageBus&&) = delete;
+
+    /**
+     * <b>Subscribe a handler to the raw frames of an ID.</b>
+     *
+     * @param id the reserved ID to receive
+     * @param handler called with every published frame of that ID
+     * @param context passed through to the handler
+     * @return The handler's index for getStats(); INVALID_HANDLER if the ID isn't reserved or the bus is full
+     */
+    size_t subscribe(const ReservedIDs id, const FrameHandler handler, void* context)
+    {
+        return insert(reservedIdIndex(id), &invokeFrame, reinterpret_cast<void (*)()>(handler), context, false);
+    }
+
+    /**
+     * <b>Subscribe a handler to the decoded messages of MESSAGE::ID.</b>
+     *
+     * @tparam MESSAGE a message struct from MessageCodecs.h
+     * @param handler called with every published frame of MESSAGE::ID that decodes successfully
+     * @param context passed through to the handler
+     * @return The handler's index for getStats(); INVALID_HANDLER if the bus is full
+     */
+    template <typename MESSAGE> size_t subscribe(const MessageHandler<MESSAGE> handler, void* context)
+    {
+        static_assert(sizeof(MESSAGE) <= SCRATCH_SIZE, "MessageBus SCRATCH_SIZE is too small for this message");
+        static_assert(alignof(MESSAGE) <= alignof(uint64_t), "MessageBus scratch buffer is not aligned for this message");
+
+        const size_t index = reservedIdIndex(MESSAGE::ID);
+        const size_t handle =
+            insert(index, &invokeMessage<MESSAGE>, reinterpret_cast<void (*)()>(handler), context, true);
+        if (handle != INVALID_HANDLER)
+        {
+            m_Decoders[index] = &decode<MESSAGE>;
+        }
+        return handle;
+    }
+
+    /**
+     * <b>Call every handler subscribed to the frame's ID.</b>
+     *
+     * Typed handlers are skipped if the frame doesn't decode, e.g. because it's too short; raw handlers still run.
+     *
+     * @param frame the received frame
+     * @return The number of handlers called
+     */
+    size_t publish(const CanFrame& frame)
+    {
+        const size_t index = reservedIdIndex(frame.id);
+        if (index == RESERVED_ID_COUNT || m_Offsets[index] == m_Offsets[index + 1])
+        {
+            m_Unrouted++;
+            return 0;
+        }
+
+        bool decoded = false;
+        if (m_Decoders[index] != nullptr)
+        {
+            decoded = m_Decoders[index](frame, m_Scratch);
+            if (!decoded)
+            {
+                m_DecodeErrors++;
+            }
+        }
+
+        size_t called = 0;
+        for (size_t i = m_Offsets[index]; i < m_Offsets[index + 1]; i++)
+        {
+            const Subscription& subscription = m_Subscriptions[i];
+            if (subscription.typed && !decoded)
+            {
+                continue;
+            }
+            MessageHandlerStats& stats = m_Stats[subscription.handle];
+            const uint32_t start = m_Clock != nullptr ? m_Clock() : 0;
+            subscription.invoke(subscription, frame, m_Scratch);
+            const uint32_t elapsed = m_Clock != nullptr ? m_Clock() - start : 0;
+
+            stats.calls++;
+            stats.lastTicks = elapsed;
+            stats.maxTicks = elapsed > stats.maxTicks ? elapsed : stats.maxTicks;
+            stats.totalTicks += elapsed;
+            called++;
+        }
+        return called;
+    }
+
+    /**
+     * @param handle a value returned by subscribe()
+     * @return the handler's execution-time counters; nullptr for an invalid handle
+     */
+    [[nodiscard]] const MessageHandlerStats* getStats(const size_t handle) const
+    {
+        return handle < m_Count ? &m_Stats[handle] : nullptr;
+    }
+
+    /** <b>Zero the execution-time counters of every handler.</b> */
+    void resetStats()
+    {
+        for (size_t i = 0; i < m_Count; i++)
+        {
+            m_Stats[i] = {};
+        }
+    }
+
+    /** @return the number of handlers subscribed to an ID */
+    [[nodiscard]] size_t getSubscriberCount(const uint32_t id) const
+    {
+        const size_t index = reservedIdIndex(id);
+        return index == RESERVED_ID_COUNT ? 0 : m_Offsets[index + 1] - m_Offsets[index];
+    }
+
+    /** @return the total number of subscriptions */
+    [[nodiscard]] size_t getHandlerCount() const
+    {
+        return m_Count;
+    }
+
+    /** @return the number of published frames no handler was subscribed to */
+    [[nodiscard]] uint32_t getUnroutedCount() const
+    {
+        return m_Unrouted;
+    }
+
+    /** @return the number of published frames that failed to decode for typed handlers */
+    [[nodiscard]] uint32_t getDecodeErrorCount() const
+    {
+        return m_DecodeErrors;
+    }
+
+private:
+    struct Subscription;
+
+    /** Calls the handler stored in a subscription with the frame or the decoded message. */
+    using Invoker = void (*)(const Subscription& subscription, const CanFrame& frame, const void* scratch);
+
+    /** Decodes a frame into the scratch buffer. */
+    using Decoder = bool (*)(const CanFrame& frame, void* scratch);
+
+    /** One handler in the flat subscription array. */
+    struct Subscription
+    {
+        /** Casts handler back to its real type and calls it. */
+        Invoker invoke = nullptr;
+        /** The handler, stored type-erased; only invoke knows its real type. */
+        void (*handler)() = nullptr;
+        /** Passed through to the handler. */
+        void* context = nullptr;
+        /** Index into m_Stats, stable across later subscriptions. */
+        uint8_t handle = 0;
+        /** True if the handler takes the decoded message rather than the frame. */
+        bool typed = false;
+    };
+
+    static_assert(MAX_HANDLERS <= 255, "MessageBus supports up to 255 handlers");
+
+    static void invokeFrame(const Subscription& subscription, const CanFrame& frame, const void*)
+    {
+        reinterpret_cast<FrameHandler>(subscription.handler)(frame, subscription.context);
+    }
+
+    template <typename MESSAGE>
+    static void invokeMessage(const Subscription& subscription, const CanFrame&, const void* scratch)
+    {
+        reinterpret_cast<MessageHandler<MESSAGE>>(subscription.handler)(*static_cast<const MESSAGE*>(scratch),
+                                                                        subscription.context);
+    }
+
+    template <typename MESSAGE> static bool decode(const CanFrame& frame, void* scratch)
+    {
+        return unpack(frame, *new (scratch) MESSAGE());
+    }
+
+    /** Insert a subscription at the end of its ID's range, shifting later ranges up by one. */
+    size_t insert(const size_t index, const Invoker invoke, void (*handler)(), void* context, const bool typed)
+    {
+        if (index == RESERVED_ID_COUNT || m_Count >= MAX_HANDLERS || handler == nullptr)
+        {
+            return INVALID_HANDLER;
+        }
+
+        const size_t position = m_Offsets[index + 1];
+        for (size_t i = m_Count; i > position; i--)
+        {
+            m_Subscriptions[i] = m_Subscriptions[i - 1];
+        }
+        for (size_t i = index + 1; i <= RESERVED_ID_COUNT; i++)
+        {
+            m_Offsets[i]++;
+        }
+
+        const size_t handle = m_Count++;
+        m_Subscriptions[position] = {invoke, handler, context, static_cast<uint8_t>(handle), typed};
+        m_Stats[handle] = {};
+        return handle;
+    }
+
+    /** Subscriptions sorted by dense ID index. */
+    Subscription m_Subscriptions[MAX_HANDLERS] = {};
+    /** Start of each ID's range in m_Subscriptions; m_Offsets[i + 1] is its end. */
+    uint8_t m_Offsets[RESERVED_ID_COUNT + 1] = {};
+    /** Decoder for each ID with typed handlers. */
+    Decoder m_Decoders[RESERVED_ID_COUNT] = {};
+    /** Execution-time counters, indexed by handle. */
+    MessageHandlerStats m_Stats[MAX_HANDLERS] = {};
+    /** Holds the decoded message during publish(). */
+    alignas(uint64_t) uint8_t m_Scratch[SCRATCH_SIZE] = {};
+    /** Function used to time handlers. */
+    Clock m_Clock;
+    /** Number of subscriptions. */
+    size_t m_Count = 0;
+    /** Published frames no handler was subscribed to. */
+    uint32_t m_Unrouted = 0;
+    /** Published frames that failed to decode for typed handlers. */
+    uint32_t m_DecodeErrors = 0;
+};
+
+#endif //MESSAGEBUS_H
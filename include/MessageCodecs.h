@@ -0,0 +1,2381 @@
+// Generated by tools/dbcgen.py from dbc/reserved.dbc - do not edit, edit the DBC file and regenerate.
+
+#ifndef MESSAGECODECS_H
+#define MESSAGECODECS_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/*
+ * Every message with signals gets a struct of raw signal values and a pack()/unpack() overload. Byte-aligned
+ * signals are a single memcpy at a constant offset; other signals are shifted and masked out of one 64-bit
+ * load with constant shifts. Scaled signals also get get<Signal>()/set<Signal>() in physical units.
+ * Payloads are little-endian, like BufferPacker.
+ */
+
+/** StartSwitchId (0x000), 1 bytes, sent by Dash. */
+struct StartSwitchMessage
+{
+    static constexpr ReservedIDs ID = StartSwitchId;
+    static constexpr uint8_t DLC = 1;
+
+    /** Bit 0. */
+    bool pressed = false;
+};
+
+/**
+ * <b>Unpack the signals of StartSwitchId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 1 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, StartSwitchMessage& message)
+{
+    if (frame.id != StartSwitchMessage::ID || frame.len < 1)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.pressed = word & 1u;
+    return true;
+}
+
+/** <b>Pack the signals of StartSwitchId into a frame.</b> */
+inline void pack(const StartSwitchMessage& message, CanFrame& frame)
+{
+    frame.id = StartSwitchMessage::ID;
+    frame.len = StartSwitchMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(message.pressed) & 0x1ULL);
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** Throttle1PositionId (0x001), 2 bytes, sent by PedalBox every 1 ms. */
+struct Throttle1PositionMessage
+{
+    static constexpr ReservedIDs ID = Throttle1PositionId;
+    static constexpr uint8_t DLC = 2;
+
+    /** Bits 0-15. */
+    uint16_t position = 0;
+};
+
+/**
+ * <b>Unpack the signals of Throttle1PositionId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, Throttle1PositionMessage& message)
+{
+    if (frame.id != Throttle1PositionMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.position, &frame.buf[0], sizeof(message.position));
+    return true;
+}
+
+/** <b>Pack the signals of Throttle1PositionId into a frame.</b> */
+inline void pack(const Throttle1PositionMessage& message, CanFrame& frame)
+{
+    frame.id = Throttle1PositionMessage::ID;
+    frame.len = Throttle1PositionMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.position, sizeof(message.position));
+}
+
+/** Throttle2PositionId (0x002), 2 bytes, sent by PedalBox every 1 ms. */
+struct Throttle2PositionMessage
+{
+    static constexpr ReservedIDs ID = Throttle2PositionId;
+    static constexpr uint8_t DLC = 2;
+
+    /** Bits 0-15. */
+    uint16_t position = 0;
+};
+
+/**
+ * <b>Unpack the signals of Throttle2PositionId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, Throttle2PositionMessage& message)
+{
+    if (frame.id != Throttle2PositionMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.position, &frame.buf[0], sizeof(message.position));
+    return true;
+}
+
+/** <b>Pack the signals of Throttle2PositionId into a frame.</b> */
+inline void pack(const Throttle2PositionMessage& message, CanFrame& frame)
+{
+    frame.id = Throttle2PositionMessage::ID;
+    frame.len = Throttle2PositionMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.position, sizeof(message.position));
+}
+
+/** BrakePressureId (0x003), 2 bytes, sent by PedalBox every 1 ms. */
+struct BrakePressureMessage
+{
+    static constexpr ReservedIDs ID = BrakePressureId;
+    static constexpr uint8_t DLC = 2;
+
+    /** Bits 0-15. */
+    uint16_t pressure = 0;
+};
+
+/**
+ * <b>Unpack the signals of BrakePressureId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, BrakePressureMessage& message)
+{
+    if (frame.id != BrakePressureMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.pressure, &frame.buf[0], sizeof(message.pressure));
+    return true;
+}
+
+/** <b>Pack the signals of BrakePressureId into a frame.</b> */
+inline void pack(const BrakePressureMessage& message, CanFrame& frame)
+{
+    frame.id = BrakePressureMessage::ID;
+    frame.len = BrakePressureMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.pressure, sizeof(message.pressure));
+}
+
+/** BMSPercentageId (0x007), 1 bytes, sent by BMS every 1000 ms. */
+struct BMSPercentageMessage
+{
+    static constexpr ReservedIDs ID = BMSPercentageId;
+    static constexpr uint8_t DLC = 1;
+
+    /** Bits 0-7, %. */
+    uint8_t stateOfCharge = 0;
+};
+
+/**
+ * <b>Unpack the signals of BMSPercentageId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 1 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, BMSPercentageMessage& message)
+{
+    if (frame.id != BMSPercentageMessage::ID || frame.len < 1)
+    {
+        return false;
+    }
+    memcpy(&message.stateOfCharge, &frame.buf[0], sizeof(message.stateOfCharge));
+    return true;
+}
+
+/** <b>Pack the signals of BMSPercentageId into a frame.</b> */
+inline void pack(const BMSPercentageMessage& message, CanFrame& frame)
+{
+    frame.id = BMSPercentageMessage::ID;
+    frame.len = BMSPercentageMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.stateOfCharge, sizeof(message.stateOfCharge));
+}
+
+/** BMSTemperatureId (0x008), 2 bytes, sent by BMS every 1000 ms. */
+struct BMSTemperatureMessage
+{
+    static constexpr ReservedIDs ID = BMSTemperatureId;
+    static constexpr uint8_t DLC = 2;
+    static constexpr float TEMPERATURE_SCALE = 0.1f;
+    static constexpr float TEMPERATURE_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, degC. */
+    int16_t temperature = 0;
+
+    /** @return temperature in degC */
+    [[nodiscard]] float getTemperature() const
+    {
+        return temperature * TEMPERATURE_SCALE + TEMPERATURE_OFFSET;
+    }
+
+    /** <b>Set temperature from a value in degC, rounding to the nearest raw step.</b> */
+    void setTemperature(const float value)
+    {
+        temperature = static_cast<int16_t>(lroundf((value - TEMPERATURE_OFFSET) / TEMPERATURE_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of BMSTemperatureId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, BMSTemperatureMessage& message)
+{
+    if (frame.id != BMSTemperatureMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.temperature, &frame.buf[0], sizeof(message.temperature));
+    return true;
+}
+
+/** <b>Pack the signals of BMSTemperatureId into a frame.</b> */
+inline void pack(const BMSTemperatureMessage& message, CanFrame& frame)
+{
+    frame.id = BMSTemperatureMessage::ID;
+    frame.len = BMSTemperatureMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.temperature, sizeof(message.temperature));
+}
+
+/** SteeringWheelAngleId (0x009), 2 bytes, sent by Sensors every 10 ms. */
+struct SteeringWheelAngleMessage
+{
+    static constexpr ReservedIDs ID = SteeringWheelAngleId;
+    static constexpr uint8_t DLC = 2;
+    static constexpr float ANGLE_SCALE = 0.1f;
+    static constexpr float ANGLE_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, deg. */
+    int16_t angle = 0;
+
+    /** @return angle in deg */
+    [[nodiscard]] float getAngle() const
+    {
+        return angle * ANGLE_SCALE + ANGLE_OFFSET;
+    }
+
+    /** <b>Set angle from a value in deg, rounding to the nearest raw step.</b> */
+    void setAngle(const float value)
+    {
+        angle = static_cast<int16_t>(lroundf((value - ANGLE_OFFSET) / ANGLE_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of SteeringWheelAngleId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, SteeringWheelAngleMessage& message)
+{
+    if (frame.id != SteeringWheelAngleMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.angle, &frame.buf[0], sizeof(message.angle));
+    return true;
+}
+
+/** <b>Pack the signals of SteeringWheelAngleId into a frame.</b> */
+inline void pack(const SteeringWheelAngleMessage& message, CanFrame& frame)
+{
+    frame.id = SteeringWheelAngleMessage::ID;
+    frame.len = SteeringWheelAngleMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.angle, sizeof(message.angle));
+}
+
+/** PedalBoxId (0x00A), 8 bytes, sent by PedalBox every 1 ms. */
+struct PedalBoxMessage
+{
+    static constexpr ReservedIDs ID = PedalBoxId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bit 0. */
+    bool startSwitch = false;
+    /** Bits 4-15. */
+    uint16_t throttle1 = 0;
+    /** Bits 16-27. */
+    uint16_t throttle2 = 0;
+    /** Bits 28-39. */
+    uint16_t brakePressure = 0;
+    /** Bits 40-47. */
+    uint8_t counter = 0;
+};
+
+/**
+ * <b>Unpack the signals of PedalBoxId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, PedalBoxMessage& message)
+{
+    if (frame.id != PedalBoxMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.startSwitch = word & 1u;
+    message.throttle1 = static_cast<uint16_t>((word >> 4) & 0xFFFULL);
+    message.throttle2 = static_cast<uint16_t>((word >> 16) & 0xFFFULL);
+    message.brakePressure = static_cast<uint16_t>((word >> 28) & 0xFFFULL);
+    message.counter = static_cast<uint8_t>((word >> 40) & 0xFFULL);
+    return true;
+}
+
+/** <b>Pack the signals of PedalBoxId into a frame.</b> */
+inline void pack(const PedalBoxMessage& message, CanFrame& frame)
+{
+    frame.id = PedalBoxMessage::ID;
+    frame.len = PedalBoxMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(message.startSwitch) & 0x1ULL)
+        | (static_cast<uint64_t>(message.throttle1) & 0xFFFULL) << 4
+        | (static_cast<uint64_t>(message.throttle2) & 0xFFFULL) << 16
+        | (static_cast<uint64_t>(message.brakePressure) & 0xFFFULL) << 28
+        | (static_cast<uint64_t>(message.counter) & 0xFFULL) << 40;
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** Temperatures1Id (0x0A0), 8 bytes, sent by RMS every 100 ms. */
+struct Temperatures1Message
+{
+    static constexpr ReservedIDs ID = Temperatures1Id;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float MODULE_A_SCALE = 0.1f;
+    static constexpr float MODULE_A_OFFSET = 0.0f;
+    static constexpr float MODULE_B_SCALE = 0.1f;
+    static constexpr float MODULE_B_OFFSET = 0.0f;
+    static constexpr float MODULE_C_SCALE = 0.1f;
+    static constexpr float MODULE_C_OFFSET = 0.0f;
+    static constexpr float GATE_DRIVER_BOARD_SCALE = 0.1f;
+    static constexpr float GATE_DRIVER_BOARD_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, degC. */
+    int16_t moduleA = 0;
+    /** Bits 16-31, raw * 0.1, degC. */
+    int16_t moduleB = 0;
+    /** Bits 32-47, raw * 0.1, degC. */
+    int16_t moduleC = 0;
+    /** Bits 48-63, raw * 0.1, degC. */
+    int16_t gateDriverBoard = 0;
+
+    /** @return moduleA in degC */
+    [[nodiscard]] float getModuleA() const
+    {
+        return moduleA * MODULE_A_SCALE + MODULE_A_OFFSET;
+    }
+
+    /** <b>Set moduleA from a value in degC, rounding to the nearest raw step.</b> */
+    void setModuleA(const float value)
+    {
+        moduleA = static_cast<int16_t>(lroundf((value - MODULE_A_OFFSET) / MODULE_A_SCALE));
+    }
+
+    /** @return moduleB in degC */
+    [[nodiscard]] float getModuleB() const
+    {
+        return moduleB * MODULE_B_SCALE + MODULE_B_OFFSET;
+    }
+
+    /** <b>Set moduleB from a value in degC, rounding to the nearest raw step.</b> */
+    void setModuleB(const float value)
+    {
+        moduleB = static_cast<int16_t>(lroundf((value - MODULE_B_OFFSET) / MODULE_B_SCALE));
+    }
+
+    /** @return moduleC in degC */
+    [[nodiscard]] float getModuleC() const
+    {
+        return moduleC * MODULE_C_SCALE + MODULE_C_OFFSET;
+    }
+
+    /** <b>Set moduleC from a value in degC, rounding to the nearest raw step.</b> */
+    void setModuleC(const float value)
+    {
+        moduleC = static_cast<int16_t>(lroundf((value - MODULE_C_OFFSET) / MODULE_C_SCALE));
+    }
+
+    /** @return gateDriverBoard in degC */
+    [[nodiscard]] float getGateDriverBoard() const
+    {
+        return gateDriverBoard * GATE_DRIVER_BOARD_SCALE + GATE_DRIVER_BOARD_OFFSET;
+    }
+
+    /** <b>Set gateDriverBoard from a value in degC, rounding to the nearest raw step.</b> */
+    void setGateDriverBoard(const float value)
+    {
+        gateDriverBoard = static_cast<int16_t>(lroundf((value - GATE_DRIVER_BOARD_OFFSET) / GATE_DRIVER_BOARD_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of Temperatures1Id.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, Temperatures1Message& message)
+{
+    if (frame.id != Temperatures1Message::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.moduleA, &frame.buf[0], sizeof(message.moduleA));
+    memcpy(&message.moduleB, &frame.buf[2], sizeof(message.moduleB));
+    memcpy(&message.moduleC, &frame.buf[4], sizeof(message.moduleC));
+    memcpy(&message.gateDriverBoard, &frame.buf[6], sizeof(message.gateDriverBoard));
+    return true;
+}
+
+/** <b>Pack the signals of Temperatures1Id into a frame.</b> */
+inline void pack(const Temperatures1Message& message, CanFrame& frame)
+{
+    frame.id = Temperatures1Message::ID;
+    frame.len = Temperatures1Message::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.moduleA, sizeof(message.moduleA));
+    memcpy(&frame.buf[2], &message.moduleB, sizeof(message.moduleB));
+    memcpy(&frame.buf[4], &message.moduleC, sizeof(message.moduleC));
+    memcpy(&frame.buf[6], &message.gateDriverBoard, sizeof(message.gateDriverBoard));
+}
+
+/** Temperatures2Id (0x0A1), 8 bytes, sent by RMS every 100 ms. */
+struct Temperatures2Message
+{
+    static constexpr ReservedIDs ID = Temperatures2Id;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float CONTROL_BOARD_SCALE = 0.1f;
+    static constexpr float CONTROL_BOARD_OFFSET = 0.0f;
+    static constexpr float RTD1_SCALE = 0.1f;
+    static constexpr float RTD1_OFFSET = 0.0f;
+    static constexpr float RTD2_SCALE = 0.1f;
+    static constexpr float RTD2_OFFSET = 0.0f;
+    static constexpr float RTD3_SCALE = 0.1f;
+    static constexpr float RTD3_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, degC. */
+    int16_t controlBoard = 0;
+    /** Bits 16-31, raw * 0.1, degC. */
+    int16_t rtd1 = 0;
+    /** Bits 32-47, raw * 0.1, degC. */
+    int16_t rtd2 = 0;
+    /** Bits 48-63, raw * 0.1, degC. */
+    int16_t rtd3 = 0;
+
+    /** @return controlBoard in degC */
+    [[nodiscard]] float getControlBoard() const
+    {
+        return controlBoard * CONTROL_BOARD_SCALE + CONTROL_BOARD_OFFSET;
+    }
+
+    /** <b>Set controlBoard from a value in degC, rounding to the nearest raw step.</b> */
+    void setControlBoard(const float value)
+    {
+        controlBoard = static_cast<int16_t>(lroundf((value - CONTROL_BOARD_OFFSET) / CONTROL_BOARD_SCALE));
+    }
+
+    /** @return rtd1 in degC */
+    [[nodiscard]] float getRtd1() const
+    {
+        return rtd1 * RTD1_SCALE + RTD1_OFFSET;
+    }
+
+    /** <b>Set rtd1 from a value in degC, rounding to the nearest raw step.</b> */
+    void setRtd1(const float value)
+    {
+        rtd1 = static_cast<int16_t>(lroundf((value - RTD1_OFFSET) / RTD1_SCALE));
+    }
+
+    /** @return rtd2 in degC */
+    [[nodiscard]] float getRtd2() const
+    {
+        return rtd2 * RTD2_SCALE + RTD2_OFFSET;
+    }
+
+    /** <b>Set rtd2 from a value in degC, rounding to the nearest raw step.</b> */
+    void setRtd2(const float value)
+    {
+        rtd2 = static_cast<int16_t>(lroundf((value - RTD2_OFFSET) / RTD2_SCALE));
+    }
+
+    /** @return rtd3 in degC */
+    [[nodiscard]] float getRtd3() const
+    {
+        return rtd3 * RTD3_SCALE + RTD3_OFFSET;
+    }
+
+    /** <b>Set rtd3 from a value in degC, rounding to the nearest raw step.</b> */
+    void setRtd3(const float value)
+    {
+        rtd3 = static_cast<int16_t>(lroundf((value - RTD3_OFFSET) / RTD3_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of Temperatures2Id.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, Temperatures2Message& message)
+{
+    if (frame.id != Temperatures2Message::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.controlBoard, &frame.buf[0], sizeof(message.controlBoard));
+    memcpy(&message.rtd1, &frame.buf[2], sizeof(message.rtd1));
+    memcpy(&message.rtd2, &frame.buf[4], sizeof(message.rtd2));
+    memcpy(&message.rtd3, &frame.buf[6], sizeof(message.rtd3));
+    return true;
+}
+
+/** <b>Pack the signals of Temperatures2Id into a frame.</b> */
+inline void pack(const Temperatures2Message& message, CanFrame& frame)
+{
+    frame.id = Temperatures2Message::ID;
+    frame.len = Temperatures2Message::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.controlBoard, sizeof(message.controlBoard));
+    memcpy(&frame.buf[2], &message.rtd1, sizeof(message.rtd1));
+    memcpy(&frame.buf[4], &message.rtd2, sizeof(message.rtd2));
+    memcpy(&frame.buf[6], &message.rtd3, sizeof(message.rtd3));
+}
+
+/** Temperatures3Id (0x0A2), 8 bytes, sent by RMS every 100 ms. */
+struct Temperatures3Message
+{
+    static constexpr ReservedIDs ID = Temperatures3Id;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float RTD4_SCALE = 0.1f;
+    static constexpr float RTD4_OFFSET = 0.0f;
+    static constexpr float RTD5_SCALE = 0.1f;
+    static constexpr float RTD5_OFFSET = 0.0f;
+    static constexpr float MOTOR_SCALE = 0.1f;
+    static constexpr float MOTOR_OFFSET = 0.0f;
+    static constexpr float TORQUE_SHUDDER_SCALE = 0.1f;
+    static constexpr float TORQUE_SHUDDER_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, degC. */
+    int16_t rtd4 = 0;
+    /** Bits 16-31, raw * 0.1, degC. */
+    int16_t rtd5 = 0;
+    /** Bits 32-47, raw * 0.1, degC. */
+    int16_t motor = 0;
+    /** Bits 48-63, raw * 0.1, Nm. */
+    int16_t torqueShudder = 0;
+
+    /** @return rtd4 in degC */
+    [[nodiscard]] float getRtd4() const
+    {
+        return rtd4 * RTD4_SCALE + RTD4_OFFSET;
+    }
+
+    /** <b>Set rtd4 from a value in degC, rounding to the nearest raw step.</b> */
+    void setRtd4(const float value)
+    {
+        rtd4 = static_cast<int16_t>(lroundf((value - RTD4_OFFSET) / RTD4_SCALE));
+    }
+
+    /** @return rtd5 in degC */
+    [[nodiscard]] float getRtd5() const
+    {
+        return rtd5 * RTD5_SCALE + RTD5_OFFSET;
+    }
+
+    /** <b>Set rtd5 from a value in degC, rounding to the nearest raw step.</b> */
+    void setRtd5(const float value)
+    {
+        rtd5 = static_cast<int16_t>(lroundf((value - RTD5_OFFSET) / RTD5_SCALE));
+    }
+
+    /** @return motor in degC */
+    [[nodiscard]] float getMotor() const
+    {
+        return motor * MOTOR_SCALE + MOTOR_OFFSET;
+    }
+
+    /** <b>Set motor from a value in degC, rounding to the nearest raw step.</b> */
+    void setMotor(const float value)
+    {
+        motor = static_cast<int16_t>(lroundf((value - MOTOR_OFFSET) / MOTOR_SCALE));
+    }
+
+    /** @return torqueShudder in Nm */
+    [[nodiscard]] float getTorqueShudder() const
+    {
+        return torqueShudder * TORQUE_SHUDDER_SCALE + TORQUE_SHUDDER_OFFSET;
+    }
+
+    /** <b>Set torqueShudder from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueShudder(const float value)
+    {
+        torqueShudder = static_cast<int16_t>(lroundf((value - TORQUE_SHUDDER_OFFSET) / TORQUE_SHUDDER_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of Temperatures3Id.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, Temperatures3Message& message)
+{
+    if (frame.id != Temperatures3Message::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.rtd4, &frame.buf[0], sizeof(message.rtd4));
+    memcpy(&message.rtd5, &frame.buf[2], sizeof(message.rtd5));
+    memcpy(&message.motor, &frame.buf[4], sizeof(message.motor));
+    memcpy(&message.torqueShudder, &frame.buf[6], sizeof(message.torqueShudder));
+    return true;
+}
+
+/** <b>Pack the signals of Temperatures3Id into a frame.</b> */
+inline void pack(const Temperatures3Message& message, CanFrame& frame)
+{
+    frame.id = Temperatures3Message::ID;
+    frame.len = Temperatures3Message::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.rtd4, sizeof(message.rtd4));
+    memcpy(&frame.buf[2], &message.rtd5, sizeof(message.rtd5));
+    memcpy(&frame.buf[4], &message.motor, sizeof(message.motor));
+    memcpy(&frame.buf[6], &message.torqueShudder, sizeof(message.torqueShudder));
+}
+
+/** AnalogInputVoltagesId (0x0A3), 8 bytes, sent by RMS. */
+struct AnalogInputVoltagesMessage
+{
+    static constexpr ReservedIDs ID = AnalogInputVoltagesId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float ANALOG_INPUT1_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT1_OFFSET = 0.0f;
+    static constexpr float ANALOG_INPUT2_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT2_OFFSET = 0.0f;
+    static constexpr float ANALOG_INPUT3_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT3_OFFSET = 0.0f;
+    static constexpr float ANALOG_INPUT4_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT4_OFFSET = 0.0f;
+    static constexpr float ANALOG_INPUT5_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT5_OFFSET = 0.0f;
+    static constexpr float ANALOG_INPUT6_SCALE = 0.01f;
+    static constexpr float ANALOG_INPUT6_OFFSET = 0.0f;
+
+    /** Bits 0-9, raw * 0.01, V. */
+    uint16_t analogInput1 = 0;
+    /** Bits 10-19, raw * 0.01, V. */
+    uint16_t analogInput2 = 0;
+    /** Bits 20-29, raw * 0.01, V. */
+    uint16_t analogInput3 = 0;
+    /** Bits 32-41, raw * 0.01, V. */
+    uint16_t analogInput4 = 0;
+    /** Bits 42-51, raw * 0.01, V. */
+    uint16_t analogInput5 = 0;
+    /** Bits 52-61, raw * 0.01, V. */
+    uint16_t analogInput6 = 0;
+
+    /** @return analogInput1 in V */
+    [[nodiscard]] float getAnalogInput1() const
+    {
+        return analogInput1 * ANALOG_INPUT1_SCALE + ANALOG_INPUT1_OFFSET;
+    }
+
+    /** <b>Set analogInput1 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput1(const float value)
+    {
+        analogInput1 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT1_OFFSET) / ANALOG_INPUT1_SCALE));
+    }
+
+    /** @return analogInput2 in V */
+    [[nodiscard]] float getAnalogInput2() const
+    {
+        return analogInput2 * ANALOG_INPUT2_SCALE + ANALOG_INPUT2_OFFSET;
+    }
+
+    /** <b>Set analogInput2 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput2(const float value)
+    {
+        analogInput2 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT2_OFFSET) / ANALOG_INPUT2_SCALE));
+    }
+
+    /** @return analogInput3 in V */
+    [[nodiscard]] float getAnalogInput3() const
+    {
+        return analogInput3 * ANALOG_INPUT3_SCALE + ANALOG_INPUT3_OFFSET;
+    }
+
+    /** <b>Set analogInput3 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput3(const float value)
+    {
+        analogInput3 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT3_OFFSET) / ANALOG_INPUT3_SCALE));
+    }
+
+    /** @return analogInput4 in V */
+    [[nodiscard]] float getAnalogInput4() const
+    {
+        return analogInput4 * ANALOG_INPUT4_SCALE + ANALOG_INPUT4_OFFSET;
+    }
+
+    /** <b>Set analogInput4 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput4(const float value)
+    {
+        analogInput4 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT4_OFFSET) / ANALOG_INPUT4_SCALE));
+    }
+
+    /** @return analogInput5 in V */
+    [[nodiscard]] float getAnalogInput5() const
+    {
+        return analogInput5 * ANALOG_INPUT5_SCALE + ANALOG_INPUT5_OFFSET;
+    }
+
+    /** <b>Set analogInput5 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput5(const float value)
+    {
+        analogInput5 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT5_OFFSET) / ANALOG_INPUT5_SCALE));
+    }
+
+    /** @return analogInput6 in V */
+    [[nodiscard]] float getAnalogInput6() const
+    {
+        return analogInput6 * ANALOG_INPUT6_SCALE + ANALOG_INPUT6_OFFSET;
+    }
+
+    /** <b>Set analogInput6 from a value in V, rounding to the nearest raw step.</b> */
+    void setAnalogInput6(const float value)
+    {
+        analogInput6 = static_cast<uint16_t>(lroundf((value - ANALOG_INPUT6_OFFSET) / ANALOG_INPUT6_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of AnalogInputVoltagesId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, AnalogInputVoltagesMessage& message)
+{
+    if (frame.id != AnalogInputVoltagesMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.analogInput1 = static_cast<uint16_t>(word & 0x3FFULL);
+    message.analogInput2 = static_cast<uint16_t>((word >> 10) & 0x3FFULL);
+    message.analogInput3 = static_cast<uint16_t>((word >> 20) & 0x3FFULL);
+    message.analogInput4 = static_cast<uint16_t>((word >> 32) & 0x3FFULL);
+    message.analogInput5 = static_cast<uint16_t>((word >> 42) & 0x3FFULL);
+    message.analogInput6 = static_cast<uint16_t>((word >> 52) & 0x3FFULL);
+    return true;
+}
+
+/** <b>Pack the signals of AnalogInputVoltagesId into a frame.</b> */
+inline void pack(const AnalogInputVoltagesMessage& message, CanFrame& frame)
+{
+    frame.id = AnalogInputVoltagesMessage::ID;
+    frame.len = AnalogInputVoltagesMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(message.analogInput1) & 0x3FFULL)
+        | (static_cast<uint64_t>(message.analogInput2) & 0x3FFULL) << 10
+        | (static_cast<uint64_t>(message.analogInput3) & 0x3FFULL) << 20
+        | (static_cast<uint64_t>(message.analogInput4) & 0x3FFULL) << 32
+        | (static_cast<uint64_t>(message.analogInput5) & 0x3FFULL) << 42
+        | (static_cast<uint64_t>(message.analogInput6) & 0x3FFULL) << 52;
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** DigitalInputStatusId (0x0A4), 8 bytes, sent by RMS. */
+struct DigitalInputStatusMessage
+{
+    static constexpr ReservedIDs ID = DigitalInputStatusId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bit 0. */
+    bool forwardSwitch = false;
+    /** Bit 8. */
+    bool reverseSwitch = false;
+    /** Bit 16. */
+    bool brakeSwitch = false;
+    /** Bit 24. */
+    bool regenDisable = false;
+    /** Bit 32. */
+    bool ignition = false;
+    /** Bit 40. */
+    bool start = false;
+    /** Bit 48. */
+    bool valetMode = false;
+    /** Bit 56. */
+    bool digitalInput8 = false;
+};
+
+/**
+ * <b>Unpack the signals of DigitalInputStatusId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DigitalInputStatusMessage& message)
+{
+    if (frame.id != DigitalInputStatusMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.forwardSwitch = word & 1u;
+    message.reverseSwitch = (word >> 8) & 1u;
+    message.brakeSwitch = (word >> 16) & 1u;
+    message.regenDisable = (word >> 24) & 1u;
+    message.ignition = (word >> 32) & 1u;
+    message.start = (word >> 40) & 1u;
+    message.valetMode = (word >> 48) & 1u;
+    message.digitalInput8 = (word >> 56) & 1u;
+    return true;
+}
+
+/** <b>Pack the signals of DigitalInputStatusId into a frame.</b> */
+inline void pack(const DigitalInputStatusMessage& message, CanFrame& frame)
+{
+    frame.id = DigitalInputStatusMessage::ID;
+    frame.len = DigitalInputStatusMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(message.forwardSwitch) & 0x1ULL)
+        | (static_cast<uint64_t>(message.reverseSwitch) & 0x1ULL) << 8
+        | (static_cast<uint64_t>(message.brakeSwitch) & 0x1ULL) << 16
+        | (static_cast<uint64_t>(message.regenDisable) & 0x1ULL) << 24
+        | (static_cast<uint64_t>(message.ignition) & 0x1ULL) << 32
+        | (static_cast<uint64_t>(message.start) & 0x1ULL) << 40
+        | (static_cast<uint64_t>(message.valetMode) & 0x1ULL) << 48
+        | (static_cast<uint64_t>(message.digitalInput8) & 0x1ULL) << 56;
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** MotorPositionInfoId (0x0A5), 8 bytes, sent by RMS every 3 ms. */
+struct MotorPositionInfoMessage
+{
+    static constexpr ReservedIDs ID = MotorPositionInfoId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float MOTOR_ANGLE_SCALE = 0.1f;
+    static constexpr float MOTOR_ANGLE_OFFSET = 0.0f;
+    static constexpr float ELECTRICAL_FREQUENCY_SCALE = 0.1f;
+    static constexpr float ELECTRICAL_FREQUENCY_OFFSET = 0.0f;
+    static constexpr float DELTA_RESOLVER_FILTERED_SCALE = 0.1f;
+    static constexpr float DELTA_RESOLVER_FILTERED_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, deg. */
+    uint16_t motorAngle = 0;
+    /** Bits 16-31, rpm. */
+    int16_t motorSpeed = 0;
+    /** Bits 32-47, raw * 0.1, Hz. */
+    int16_t electricalFrequency = 0;
+    /** Bits 48-63, raw * 0.1, deg. */
+    int16_t deltaResolverFiltered = 0;
+
+    /** @return motorAngle in deg */
+    [[nodiscard]] float getMotorAngle() const
+    {
+        return motorAngle * MOTOR_ANGLE_SCALE + MOTOR_ANGLE_OFFSET;
+    }
+
+    /** <b>Set motorAngle from a value in deg, rounding to the nearest raw step.</b> */
+    void setMotorAngle(const float value)
+    {
+        motorAngle = static_cast<uint16_t>(lroundf((value - MOTOR_ANGLE_OFFSET) / MOTOR_ANGLE_SCALE));
+    }
+
+    /** @return electricalFrequency in Hz */
+    [[nodiscard]] float getElectricalFrequency() const
+    {
+        return electricalFrequency * ELECTRICAL_FREQUENCY_SCALE + ELECTRICAL_FREQUENCY_OFFSET;
+    }
+
+    /** <b>Set electricalFrequency from a value in Hz, rounding to the nearest raw step.</b> */
+    void setElectricalFrequency(const float value)
+    {
+        electricalFrequency = static_cast<int16_t>(lroundf((value - ELECTRICAL_FREQUENCY_OFFSET) / ELECTRICAL_FREQUENCY_SCALE));
+    }
+
+    /** @return deltaResolverFiltered in deg */
+    [[nodiscard]] float getDeltaResolverFiltered() const
+    {
+        return deltaResolverFiltered * DELTA_RESOLVER_FILTERED_SCALE + DELTA_RESOLVER_FILTERED_OFFSET;
+    }
+
+    /** <b>Set deltaResolverFiltered from a value in deg, rounding to the nearest raw step.</b> */
+    void setDeltaResolverFiltered(const float value)
+    {
+        deltaResolverFiltered = static_cast<int16_t>(lroundf((value - DELTA_RESOLVER_FILTERED_OFFSET) / DELTA_RESOLVER_FILTERED_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of MotorPositionInfoId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, MotorPositionInfoMessage& message)
+{
+    if (frame.id != MotorPositionInfoMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.motorAngle, &frame.buf[0], sizeof(message.motorAngle));
+    memcpy(&message.motorSpeed, &frame.buf[2], sizeof(message.motorSpeed));
+    memcpy(&message.electricalFrequency, &frame.buf[4], sizeof(message.electricalFrequency));
+    memcpy(&message.deltaResolverFiltered, &frame.buf[6], sizeof(message.deltaResolverFiltered));
+    return true;
+}
+
+/** <b>Pack the signals of MotorPositionInfoId into a frame.</b> */
+inline void pack(const MotorPositionInfoMessage& message, CanFrame& frame)
+{
+    frame.id = MotorPositionInfoMessage::ID;
+    frame.len = MotorPositionInfoMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.motorAngle, sizeof(message.motorAngle));
+    memcpy(&frame.buf[2], &message.motorSpeed, sizeof(message.motorSpeed));
+    memcpy(&frame.buf[4], &message.electricalFrequency, sizeof(message.electricalFrequency));
+    memcpy(&frame.buf[6], &message.deltaResolverFiltered, sizeof(message.deltaResolverFiltered));
+}
+
+/** CurrentInfoId (0x0A6), 8 bytes, sent by RMS every 3 ms. */
+struct CurrentInfoMessage
+{
+    static constexpr ReservedIDs ID = CurrentInfoId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float PHASE_A_CURRENT_SCALE = 0.1f;
+    static constexpr float PHASE_A_CURRENT_OFFSET = 0.0f;
+    static constexpr float PHASE_B_CURRENT_SCALE = 0.1f;
+    static constexpr float PHASE_B_CURRENT_OFFSET = 0.0f;
+    static constexpr float PHASE_C_CURRENT_SCALE = 0.1f;
+    static constexpr float PHASE_C_CURRENT_OFFSET = 0.0f;
+    static constexpr float DC_BUS_CURRENT_SCALE = 0.1f;
+    static constexpr float DC_BUS_CURRENT_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, A. */
+    int16_t phaseACurrent = 0;
+    /** Bits 16-31, raw * 0.1, A. */
+    int16_t phaseBCurrent = 0;
+    /** Bits 32-47, raw * 0.1, A. */
+    int16_t phaseCCurrent = 0;
+    /** Bits 48-63, raw * 0.1, A. */
+    int16_t dcBusCurrent = 0;
+
+    /** @return phaseACurrent in A */
+    [[nodiscard]] float getPhaseACurrent() const
+    {
+        return phaseACurrent * PHASE_A_CURRENT_SCALE + PHASE_A_CURRENT_OFFSET;
+    }
+
+    /** <b>Set phaseACurrent from a value in A, rounding to the nearest raw step.</b> */
+    void setPhaseACurrent(const float value)
+    {
+        phaseACurrent = static_cast<int16_t>(lroundf((value - PHASE_A_CURRENT_OFFSET) / PHASE_A_CURRENT_SCALE));
+    }
+
+    /** @return phaseBCurrent in A */
+    [[nodiscard]] float getPhaseBCurrent() const
+    {
+        return phaseBCurrent * PHASE_B_CURRENT_SCALE + PHASE_B_CURRENT_OFFSET;
+    }
+
+    /** <b>Set phaseBCurrent from a value in A, rounding to the nearest raw step.</b> */
+    void setPhaseBCurrent(const float value)
+    {
+        phaseBCurrent = static_cast<int16_t>(lroundf((value - PHASE_B_CURRENT_OFFSET) / PHASE_B_CURRENT_SCALE));
+    }
+
+    /** @return phaseCCurrent in A */
+    [[nodiscard]] float getPhaseCCurrent() const
+    {
+        return phaseCCurrent * PHASE_C_CURRENT_SCALE + PHASE_C_CURRENT_OFFSET;
+    }
+
+    /** <b>Set phaseCCurrent from a value in A, rounding to the nearest raw step.</b> */
+    void setPhaseCCurrent(const float value)
+    {
+        phaseCCurrent = static_cast<int16_t>(lroundf((value - PHASE_C_CURRENT_OFFSET) / PHASE_C_CURRENT_SCALE));
+    }
+
+    /** @return dcBusCurrent in A */
+    [[nodiscard]] float getDcBusCurrent() const
+    {
+        return dcBusCurrent * DC_BUS_CURRENT_SCALE + DC_BUS_CURRENT_OFFSET;
+    }
+
+    /** <b>Set dcBusCurrent from a value in A, rounding to the nearest raw step.</b> */
+    void setDcBusCurrent(const float value)
+    {
+        dcBusCurrent = static_cast<int16_t>(lroundf((value - DC_BUS_CURRENT_OFFSET) / DC_BUS_CURRENT_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of CurrentInfoId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, CurrentInfoMessage& message)
+{
+    if (frame.id != CurrentInfoMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.phaseACurrent, &frame.buf[0], sizeof(message.phaseACurrent));
+    memcpy(&message.phaseBCurrent, &frame.buf[2], sizeof(message.phaseBCurrent));
+    memcpy(&message.phaseCCurrent, &frame.buf[4], sizeof(message.phaseCCurrent));
+    memcpy(&message.dcBusCurrent, &frame.buf[6], sizeof(message.dcBusCurrent));
+    return true;
+}
+
+/** <b>Pack the signals of CurrentInfoId into a frame.</b> */
+inline void pack(const CurrentInfoMessage& message, CanFrame& frame)
+{
+    frame.id = CurrentInfoMessage::ID;
+    frame.len = CurrentInfoMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.phaseACurrent, sizeof(message.phaseACurrent));
+    memcpy(&frame.buf[2], &message.phaseBCurrent, sizeof(message.phaseBCurrent));
+    memcpy(&frame.buf[4], &message.phaseCCurrent, sizeof(message.phaseCCurrent));
+    memcpy(&frame.buf[6], &message.dcBusCurrent, sizeof(message.dcBusCurrent));
+}
+
+/** VoltageInfoId (0x0A7), 8 bytes, sent by RMS every 3 ms. */
+struct VoltageInfoMessage
+{
+    static constexpr ReservedIDs ID = VoltageInfoId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float DC_BUS_VOLTAGE_SCALE = 0.1f;
+    static constexpr float DC_BUS_VOLTAGE_OFFSET = 0.0f;
+    static constexpr float OUTPUT_VOLTAGE_SCALE = 0.1f;
+    static constexpr float OUTPUT_VOLTAGE_OFFSET = 0.0f;
+    static constexpr float VAB_VD_SCALE = 0.1f;
+    static constexpr float VAB_VD_OFFSET = 0.0f;
+    static constexpr float VBC_VQ_SCALE = 0.1f;
+    static constexpr float VBC_VQ_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, V. */
+    int16_t dcBusVoltage = 0;
+    /** Bits 16-31, raw * 0.1, V. */
+    int16_t outputVoltage = 0;
+    /** Bits 32-47, raw * 0.1, V. */
+    int16_t vabVd = 0;
+    /** Bits 48-63, raw * 0.1, V. */
+    int16_t vbcVq = 0;
+
+    /** @return dcBusVoltage in V */
+    [[nodiscard]] float getDcBusVoltage() const
+    {
+        return dcBusVoltage * DC_BUS_VOLTAGE_SCALE + DC_BUS_VOLTAGE_OFFSET;
+    }
+
+    /** <b>Set dcBusVoltage from a value in V, rounding to the nearest raw step.</b> */
+    void setDcBusVoltage(const float value)
+    {
+        dcBusVoltage = static_cast<int16_t>(lroundf((value - DC_BUS_VOLTAGE_OFFSET) / DC_BUS_VOLTAGE_SCALE));
+    }
+
+    /** @return outputVoltage in V */
+    [[nodiscard]] float getOutputVoltage() const
+    {
+        return outputVoltage * OUTPUT_VOLTAGE_SCALE + OUTPUT_VOLTAGE_OFFSET;
+    }
+
+    /** <b>Set outputVoltage from a value in V, rounding to the nearest raw step.</b> */
+    void setOutputVoltage(const float value)
+    {
+        outputVoltage = static_cast<int16_t>(lroundf((value - OUTPUT_VOLTAGE_OFFSET) / OUTPUT_VOLTAGE_SCALE));
+    }
+
+    /** @return vabVd in V */
+    [[nodiscard]] float getVabVd() const
+    {
+        return vabVd * VAB_VD_SCALE + VAB_VD_OFFSET;
+    }
+
+    /** <b>Set vabVd from a value in V, rounding to the nearest raw step.</b> */
+    void setVabVd(const float value)
+    {
+        vabVd = static_cast<int16_t>(lroundf((value - VAB_VD_OFFSET) / VAB_VD_SCALE));
+    }
+
+    /** @return vbcVq in V */
+    [[nodiscard]] float getVbcVq() const
+    {
+        return vbcVq * VBC_VQ_SCALE + VBC_VQ_OFFSET;
+    }
+
+    /** <b>Set vbcVq from a value in V, rounding to the nearest raw step.</b> */
+    void setVbcVq(const float value)
+    {
+        vbcVq = static_cast<int16_t>(lroundf((value - VBC_VQ_OFFSET) / VBC_VQ_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of VoltageInfoId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, VoltageInfoMessage& message)
+{
+    if (frame.id != VoltageInfoMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.dcBusVoltage, &frame.buf[0], sizeof(message.dcBusVoltage));
+    memcpy(&message.outputVoltage, &frame.buf[2], sizeof(message.outputVoltage));
+    memcpy(&message.vabVd, &frame.buf[4], sizeof(message.vabVd));
+    memcpy(&message.vbcVq, &frame.buf[6], sizeof(message.vbcVq));
+    return true;
+}
+
+/** <b>Pack the signals of VoltageInfoId into a frame.</b> */
+inline void pack(const VoltageInfoMessage& message, CanFrame& frame)
+{
+    frame.id = VoltageInfoMessage::ID;
+    frame.len = VoltageInfoMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.dcBusVoltage, sizeof(message.dcBusVoltage));
+    memcpy(&frame.buf[2], &message.outputVoltage, sizeof(message.outputVoltage));
+    memcpy(&frame.buf[4], &message.vabVd, sizeof(message.vabVd));
+    memcpy(&frame.buf[6], &message.vbcVq, sizeof(message.vbcVq));
+}
+
+/** FluxInfoId (0x0A8), 8 bytes, sent by RMS. */
+struct FluxInfoMessage
+{
+    static constexpr ReservedIDs ID = FluxInfoId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float FLUX_COMMAND_SCALE = 0.001f;
+    static constexpr float FLUX_COMMAND_OFFSET = 0.0f;
+    static constexpr float FLUX_FEEDBACK_SCALE = 0.001f;
+    static constexpr float FLUX_FEEDBACK_OFFSET = 0.0f;
+    static constexpr float ID_FEEDBACK_SCALE = 0.1f;
+    static constexpr float ID_FEEDBACK_OFFSET = 0.0f;
+    static constexpr float IQ_FEEDBACK_SCALE = 0.1f;
+    static constexpr float IQ_FEEDBACK_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.001, Wb. */
+    int16_t fluxCommand = 0;
+    /** Bits 16-31, raw * 0.001, Wb. */
+    int16_t fluxFeedback = 0;
+    /** Bits 32-47, raw * 0.1, A. */
+    int16_t idFeedback = 0;
+    /** Bits 48-63, raw * 0.1, A. */
+    int16_t iqFeedback = 0;
+
+    /** @return fluxCommand in Wb */
+    [[nodiscard]] float getFluxCommand() const
+    {
+        return fluxCommand * FLUX_COMMAND_SCALE + FLUX_COMMAND_OFFSET;
+    }
+
+    /** <b>Set fluxCommand from a value in Wb, rounding to the nearest raw step.</b> */
+    void setFluxCommand(const float value)
+    {
+        fluxCommand = static_cast<int16_t>(lroundf((value - FLUX_COMMAND_OFFSET) / FLUX_COMMAND_SCALE));
+    }
+
+    /** @return fluxFeedback in Wb */
+    [[nodiscard]] float getFluxFeedback() const
+    {
+        return fluxFeedback * FLUX_FEEDBACK_SCALE + FLUX_FEEDBACK_OFFSET;
+    }
+
+    /** <b>Set fluxFeedback from a value in Wb, rounding to the nearest raw step.</b> */
+    void setFluxFeedback(const float value)
+    {
+        fluxFeedback = static_cast<int16_t>(lroundf((value - FLUX_FEEDBACK_OFFSET) / FLUX_FEEDBACK_SCALE));
+    }
+
+    /** @return idFeedback in A */
+    [[nodiscard]] float getIdFeedback() const
+    {
+        return idFeedback * ID_FEEDBACK_SCALE + ID_FEEDBACK_OFFSET;
+    }
+
+    /** <b>Set idFeedback from a value in A, rounding to the nearest raw step.</b> */
+    void setIdFeedback(const float value)
+    {
+        idFeedback = static_cast<int16_t>(lroundf((value - ID_FEEDBACK_OFFSET) / ID_FEEDBACK_SCALE));
+    }
+
+    /** @return iqFeedback in A */
+    [[nodiscard]] float getIqFeedback() const
+    {
+        return iqFeedback * IQ_FEEDBACK_SCALE + IQ_FEEDBACK_OFFSET;
+    }
+
+    /** <b>Set iqFeedback from a value in A, rounding to the nearest raw step.</b> */
+    void setIqFeedback(const float value)
+    {
+        iqFeedback = static_cast<int16_t>(lroundf((value - IQ_FEEDBACK_OFFSET) / IQ_FEEDBACK_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of FluxInfoId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, FluxInfoMessage& message)
+{
+    if (frame.id != FluxInfoMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.fluxCommand, &frame.buf[0], sizeof(message.fluxCommand));
+    memcpy(&message.fluxFeedback, &frame.buf[2], sizeof(message.fluxFeedback));
+    memcpy(&message.idFeedback, &frame.buf[4], sizeof(message.idFeedback));
+    memcpy(&message.iqFeedback, &frame.buf[6], sizeof(message.iqFeedback));
+    return true;
+}
+
+/** <b>Pack the signals of FluxInfoId into a frame.</b> */
+inline void pack(const FluxInfoMessage& message, CanFrame& frame)
+{
+    frame.id = FluxInfoMessage::ID;
+    frame.len = FluxInfoMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.fluxCommand, sizeof(message.fluxCommand));
+    memcpy(&frame.buf[2], &message.fluxFeedback, sizeof(message.fluxFeedback));
+    memcpy(&frame.buf[4], &message.idFeedback, sizeof(message.idFeedback));
+    memcpy(&frame.buf[6], &message.iqFeedback, sizeof(message.iqFeedback));
+}
+
+/** InternalVoltagesId (0x0A9), 8 bytes, sent by RMS. */
+struct InternalVoltagesMessage
+{
+    static constexpr ReservedIDs ID = InternalVoltagesId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float REFERENCE1_V5_SCALE = 0.01f;
+    static constexpr float REFERENCE1_V5_OFFSET = 0.0f;
+    static constexpr float REFERENCE2_V5_SCALE = 0.01f;
+    static constexpr float REFERENCE2_V5_OFFSET = 0.0f;
+    static constexpr float REFERENCE5_V_SCALE = 0.01f;
+    static constexpr float REFERENCE5_V_OFFSET = 0.0f;
+    static constexpr float SYSTEM12_V_SCALE = 0.01f;
+    static constexpr float SYSTEM12_V_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.01, V. */
+    int16_t reference1V5 = 0;
+    /** Bits 16-31, raw * 0.01, V. */
+    int16_t reference2V5 = 0;
+    /** Bits 32-47, raw * 0.01, V. */
+    int16_t reference5V = 0;
+    /** Bits 48-63, raw * 0.01, V. */
+    int16_t system12V = 0;
+
+    /** @return reference1V5 in V */
+    [[nodiscard]] float getReference1V5() const
+    {
+        return reference1V5 * REFERENCE1_V5_SCALE + REFERENCE1_V5_OFFSET;
+    }
+
+    /** <b>Set reference1V5 from a value in V, rounding to the nearest raw step.</b> */
+    void setReference1V5(const float value)
+    {
+        reference1V5 = static_cast<int16_t>(lroundf((value - REFERENCE1_V5_OFFSET) / REFERENCE1_V5_SCALE));
+    }
+
+    /** @return reference2V5 in V */
+    [[nodiscard]] float getReference2V5() const
+    {
+        return reference2V5 * REFERENCE2_V5_SCALE + REFERENCE2_V5_OFFSET;
+    }
+
+    /** <b>Set reference2V5 from a value in V, rounding to the nearest raw step.</b> */
+    void setReference2V5(const float value)
+    {
+        reference2V5 = static_cast<int16_t>(lroundf((value - REFERENCE2_V5_OFFSET) / REFERENCE2_V5_SCALE));
+    }
+
+    /** @return reference5V in V */
+    [[nodiscard]] float getReference5V() const
+    {
+        return reference5V * REFERENCE5_V_SCALE + REFERENCE5_V_OFFSET;
+    }
+
+    /** <b>Set reference5V from a value in V, rounding to the nearest raw step.</b> */
+    void setReference5V(const float value)
+    {
+        reference5V = static_cast<int16_t>(lroundf((value - REFERENCE5_V_OFFSET) / REFERENCE5_V_SCALE));
+    }
+
+    /** @return system12V in V */
+    [[nodiscard]] float getSystem12V() const
+    {
+        return system12V * SYSTEM12_V_SCALE + SYSTEM12_V_OFFSET;
+    }
+
+    /** <b>Set system12V from a value in V, rounding to the nearest raw step.</b> */
+    void setSystem12V(const float value)
+    {
+        system12V = static_cast<int16_t>(lroundf((value - SYSTEM12_V_OFFSET) / SYSTEM12_V_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of InternalVoltagesId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, InternalVoltagesMessage& message)
+{
+    if (frame.id != InternalVoltagesMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.reference1V5, &frame.buf[0], sizeof(message.reference1V5));
+    memcpy(&message.reference2V5, &frame.buf[2], sizeof(message.reference2V5));
+    memcpy(&message.reference5V, &frame.buf[4], sizeof(message.reference5V));
+    memcpy(&message.system12V, &frame.buf[6], sizeof(message.system12V));
+    return true;
+}
+
+/** <b>Pack the signals of InternalVoltagesId into a frame.</b> */
+inline void pack(const InternalVoltagesMessage& message, CanFrame& frame)
+{
+    frame.id = InternalVoltagesMessage::ID;
+    frame.len = InternalVoltagesMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.reference1V5, sizeof(message.reference1V5));
+    memcpy(&frame.buf[2], &message.reference2V5, sizeof(message.reference2V5));
+    memcpy(&frame.buf[4], &message.reference5V, sizeof(message.reference5V));
+    memcpy(&frame.buf[6], &message.system12V, sizeof(message.system12V));
+}
+
+/** InternalStatesId (0x0AA), 8 bytes, sent by RMS every 100 ms. */
+struct InternalStatesMessage
+{
+    static constexpr ReservedIDs ID = InternalStatesId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bits 0-15. */
+    uint16_t vsmState = 0;
+    /** Bits 16-23. */
+    uint8_t inverterState = 0;
+    /** Bits 24-31. */
+    uint8_t relayState = 0;
+    /** Bit 32. */
+    bool inverterRunMode = false;
+    /** Bits 37-39. */
+    uint8_t inverterActiveDischargeState = 0;
+    /** Bit 40. */
+    bool inverterCommandMode = false;
+    /** Bit 48. */
+    bool inverterEnableState = false;
+    /** Bit 55. */
+    bool inverterEnableLockout = false;
+    /** Bit 56. */
+    bool directionCommand = false;
+    /** Bit 57. */
+    bool bmsActive = false;
+    /** Bit 58. */
+    bool bmsLimitingTorque = false;
+};
+
+/**
+ * <b>Unpack the signals of InternalStatesId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, InternalStatesMessage& message)
+{
+    if (frame.id != InternalStatesMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.vsmState = static_cast<uint16_t>(word & 0xFFFFULL);
+    message.inverterState = static_cast<uint8_t>((word >> 16) & 0xFFULL);
+    message.relayState = static_cast<uint8_t>((word >> 24) & 0xFFULL);
+    message.inverterRunMode = (word >> 32) & 1u;
+    message.inverterActiveDischargeState = static_cast<uint8_t>((word >> 37) & 0x7ULL);
+    message.inverterCommandMode = (word >> 40) & 1u;
+    message.inverterEnableState = (word >> 48) & 1u;
+    message.inverterEnableLockout = (word >> 55) & 1u;
+    message.directionCommand = (word >> 56) & 1u;
+    message.bmsActive = (word >> 57) & 1u;
+    message.bmsLimitingTorque = (word >> 58) & 1u;
+    return true;
+}
+
+/** <b>Pack the signals of InternalStatesId into a frame.</b> */
+inline void pack(const InternalStatesMessage& message, CanFrame& frame)
+{
+    frame.id = InternalStatesMessage::ID;
+    frame.len = InternalStatesMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(message.vsmState) & 0xFFFFULL)
+        | (static_cast<uint64_t>(message.inverterState) & 0xFFULL) << 16
+        | (static_cast<uint64_t>(message.relayState) & 0xFFULL) << 24
+        | (static_cast<uint64_t>(message.inverterRunMode) & 0x1ULL) << 32
+        | (static_cast<uint64_t>(message.inverterActiveDischargeState) & 0x7ULL) << 37
+        | (static_cast<uint64_t>(message.inverterCommandMode) & 0x1ULL) << 40
+        | (static_cast<uint64_t>(message.inverterEnableState) & 0x1ULL) << 48
+        | (static_cast<uint64_t>(message.inverterEnableLockout) & 0x1ULL) << 55
+        | (static_cast<uint64_t>(message.directionCommand) & 0x1ULL) << 56
+        | (static_cast<uint64_t>(message.bmsActive) & 0x1ULL) << 57
+        | (static_cast<uint64_t>(message.bmsLimitingTorque) & 0x1ULL) << 58;
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** FaultCodesId (0x0AB), 8 bytes, sent by RMS every 100 ms. */
+struct FaultCodesMessage
+{
+    static constexpr ReservedIDs ID = FaultCodesId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bits 0-15. */
+    uint16_t postFaultLo = 0;
+    /** Bits 16-31. */
+    uint16_t postFaultHi = 0;
+    /** Bits 32-47. */
+    uint16_t runFaultLo = 0;
+    /** Bits 48-63. */
+    uint16_t runFaultHi = 0;
+};
+
+/**
+ * <b>Unpack the signals of FaultCodesId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, FaultCodesMessage& message)
+{
+    if (frame.id != FaultCodesMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.postFaultLo, &frame.buf[0], sizeof(message.postFaultLo));
+    memcpy(&message.postFaultHi, &frame.buf[2], sizeof(message.postFaultHi));
+    memcpy(&message.runFaultLo, &frame.buf[4], sizeof(message.runFaultLo));
+    memcpy(&message.runFaultHi, &frame.buf[6], sizeof(message.runFaultHi));
+    return true;
+}
+
+/** <b>Pack the signals of FaultCodesId into a frame.</b> */
+inline void pack(const FaultCodesMessage& message, CanFrame& frame)
+{
+    frame.id = FaultCodesMessage::ID;
+    frame.len = FaultCodesMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.postFaultLo, sizeof(message.postFaultLo));
+    memcpy(&frame.buf[2], &message.postFaultHi, sizeof(message.postFaultHi));
+    memcpy(&frame.buf[4], &message.runFaultLo, sizeof(message.runFaultLo));
+    memcpy(&frame.buf[6], &message.runFaultHi, sizeof(message.runFaultHi));
+}
+
+/** TorqueAndTimerInfoId (0x0AC), 8 bytes, sent by RMS every 3 ms. */
+struct TorqueAndTimerInfoMessage
+{
+    static constexpr ReservedIDs ID = TorqueAndTimerInfoId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float COMMANDED_TORQUE_SCALE = 0.1f;
+    static constexpr float COMMANDED_TORQUE_OFFSET = 0.0f;
+    static constexpr float TORQUE_FEEDBACK_SCALE = 0.1f;
+    static constexpr float TORQUE_FEEDBACK_OFFSET = 0.0f;
+    static constexpr float POWER_ON_TIMER_SCALE = 0.003f;
+    static constexpr float POWER_ON_TIMER_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, Nm. */
+    int16_t commandedTorque = 0;
+    /** Bits 16-31, raw * 0.1, Nm. */
+    int16_t torqueFeedback = 0;
+    /** Bits 32-63, raw * 0.003, s. */
+    uint32_t powerOnTimer = 0;
+
+    /** @return commandedTorque in Nm */
+    [[nodiscard]] float getCommandedTorque() const
+    {
+        return commandedTorque * COMMANDED_TORQUE_SCALE + COMMANDED_TORQUE_OFFSET;
+    }
+
+    /** <b>Set commandedTorque from a value in Nm, rounding to the nearest raw step.</b> */
+    void setCommandedTorque(const float value)
+    {
+        commandedTorque = static_cast<int16_t>(lroundf((value - COMMANDED_TORQUE_OFFSET) / COMMANDED_TORQUE_SCALE));
+    }
+
+    /** @return torqueFeedback in Nm */
+    [[nodiscard]] float getTorqueFeedback() const
+    {
+        return torqueFeedback * TORQUE_FEEDBACK_SCALE + TORQUE_FEEDBACK_OFFSET;
+    }
+
+    /** <b>Set torqueFeedback from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueFeedback(const float value)
+    {
+        torqueFeedback = static_cast<int16_t>(lroundf((value - TORQUE_FEEDBACK_OFFSET) / TORQUE_FEEDBACK_SCALE));
+    }
+
+    /** @return powerOnTimer in s */
+    [[nodiscard]] float getPowerOnTimer() const
+    {
+        return powerOnTimer * POWER_ON_TIMER_SCALE + POWER_ON_TIMER_OFFSET;
+    }
+
+    /** <b>Set powerOnTimer from a value in s, rounding to the nearest raw step.</b> */
+    void setPowerOnTimer(const float value)
+    {
+        powerOnTimer = static_cast<uint32_t>(lroundf((value - POWER_ON_TIMER_OFFSET) / POWER_ON_TIMER_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of TorqueAndTimerInfoId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, TorqueAndTimerInfoMessage& message)
+{
+    if (frame.id != TorqueAndTimerInfoMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.commandedTorque, &frame.buf[0], sizeof(message.commandedTorque));
+    memcpy(&message.torqueFeedback, &frame.buf[2], sizeof(message.torqueFeedback));
+    memcpy(&message.powerOnTimer, &frame.buf[4], sizeof(message.powerOnTimer));
+    return true;
+}
+
+/** <b>Pack the signals of TorqueAndTimerInfoId into a frame.</b> */
+inline void pack(const TorqueAndTimerInfoMessage& message, CanFrame& frame)
+{
+    frame.id = TorqueAndTimerInfoMessage::ID;
+    frame.len = TorqueAndTimerInfoMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.commandedTorque, sizeof(message.commandedTorque));
+    memcpy(&frame.buf[2], &message.torqueFeedback, sizeof(message.torqueFeedback));
+    memcpy(&frame.buf[4], &message.powerOnTimer, sizeof(message.powerOnTimer));
+}
+
+/** ModulationIndexId (0x0AD), 8 bytes, sent by RMS. */
+struct ModulationIndexMessage
+{
+    static constexpr ReservedIDs ID = ModulationIndexId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float MODULATION_INDEX_SCALE = 0.0001f;
+    static constexpr float MODULATION_INDEX_OFFSET = 0.0f;
+    static constexpr float FLUX_WEAKENING_OUTPUT_SCALE = 0.1f;
+    static constexpr float FLUX_WEAKENING_OUTPUT_OFFSET = 0.0f;
+    static constexpr float ID_COMMAND_SCALE = 0.1f;
+    static constexpr float ID_COMMAND_OFFSET = 0.0f;
+    static constexpr float IQ_COMMAND_SCALE = 0.1f;
+    static constexpr float IQ_COMMAND_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.0001. */
+    uint16_t modulationIndex = 0;
+    /** Bits 16-31, raw * 0.1, A. */
+    int16_t fluxWeakeningOutput = 0;
+    /** Bits 32-47, raw * 0.1, A. */
+    int16_t idCommand = 0;
+    /** Bits 48-63, raw * 0.1, A. */
+    int16_t iqCommand = 0;
+
+    /** @return modulationIndex in physical units */
+    [[nodiscard]] float getModulationIndex() const
+    {
+        return modulationIndex * MODULATION_INDEX_SCALE + MODULATION_INDEX_OFFSET;
+    }
+
+    /** <b>Set modulationIndex from a value in physical units, rounding to the nearest raw step.</b> */
+    void setModulationIndex(const float value)
+    {
+        modulationIndex = static_cast<uint16_t>(lroundf((value - MODULATION_INDEX_OFFSET) / MODULATION_INDEX_SCALE));
+    }
+
+    /** @return fluxWeakeningOutput in A */
+    [[nodiscard]] float getFluxWeakeningOutput() const
+    {
+        return fluxWeakeningOutput * FLUX_WEAKENING_OUTPUT_SCALE + FLUX_WEAKENING_OUTPUT_OFFSET;
+    }
+
+    /** <b>Set fluxWeakeningOutput from a value in A, rounding to the nearest raw step.</b> */
+    void setFluxWeakeningOutput(const float value)
+    {
+        fluxWeakeningOutput = static_cast<int16_t>(lroundf((value - FLUX_WEAKENING_OUTPUT_OFFSET) / FLUX_WEAKENING_OUTPUT_SCALE));
+    }
+
+    /** @return idCommand in A */
+    [[nodiscard]] float getIdCommand() const
+    {
+        return idCommand * ID_COMMAND_SCALE + ID_COMMAND_OFFSET;
+    }
+
+    /** <b>Set idCommand from a value in A, rounding to the nearest raw step.</b> */
+    void setIdCommand(const float value)
+    {
+        idCommand = static_cast<int16_t>(lroundf((value - ID_COMMAND_OFFSET) / ID_COMMAND_SCALE));
+    }
+
+    /** @return iqCommand in A */
+    [[nodiscard]] float getIqCommand() const
+    {
+        return iqCommand * IQ_COMMAND_SCALE + IQ_COMMAND_OFFSET;
+    }
+
+    /** <b>Set iqCommand from a value in A, rounding to the nearest raw step.</b> */
+    void setIqCommand(const float value)
+    {
+        iqCommand = static_cast<int16_t>(lroundf((value - IQ_COMMAND_OFFSET) / IQ_COMMAND_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of ModulationIndexId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ModulationIndexMessage& message)
+{
+    if (frame.id != ModulationIndexMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.modulationIndex, &frame.buf[0], sizeof(message.modulationIndex));
+    memcpy(&message.fluxWeakeningOutput, &frame.buf[2], sizeof(message.fluxWeakeningOutput));
+    memcpy(&message.idCommand, &frame.buf[4], sizeof(message.idCommand));
+    memcpy(&message.iqCommand, &frame.buf[6], sizeof(message.iqCommand));
+    return true;
+}
+
+/** <b>Pack the signals of ModulationIndexId into a frame.</b> */
+inline void pack(const ModulationIndexMessage& message, CanFrame& frame)
+{
+    frame.id = ModulationIndexMessage::ID;
+    frame.len = ModulationIndexMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.modulationIndex, sizeof(message.modulationIndex));
+    memcpy(&frame.buf[2], &message.fluxWeakeningOutput, sizeof(message.fluxWeakeningOutput));
+    memcpy(&frame.buf[4], &message.idCommand, sizeof(message.idCommand));
+    memcpy(&frame.buf[6], &message.iqCommand, sizeof(message.iqCommand));
+}
+
+/** FirmwareInformationId (0x0AE), 8 bytes, sent by RMS. */
+struct FirmwareInformationMessage
+{
+    static constexpr ReservedIDs ID = FirmwareInformationId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bits 0-15. */
+    uint16_t eepromVersion = 0;
+    /** Bits 16-31. */
+    uint16_t softwareVersion = 0;
+    /** Bits 32-47. */
+    uint16_t dateCodeMMDD = 0;
+    /** Bits 48-63. */
+    uint16_t dateCodeYYYY = 0;
+};
+
+/**
+ * <b>Unpack the signals of FirmwareInformationId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, FirmwareInformationMessage& message)
+{
+    if (frame.id != FirmwareInformationMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.eepromVersion, &frame.buf[0], sizeof(message.eepromVersion));
+    memcpy(&message.softwareVersion, &frame.buf[2], sizeof(message.softwareVersion));
+    memcpy(&message.dateCodeMMDD, &frame.buf[4], sizeof(message.dateCodeMMDD));
+    memcpy(&message.dateCodeYYYY, &frame.buf[6], sizeof(message.dateCodeYYYY));
+    return true;
+}
+
+/** <b>Pack the signals of FirmwareInformationId into a frame.</b> */
+inline void pack(const FirmwareInformationMessage& message, CanFrame& frame)
+{
+    frame.id = FirmwareInformationMessage::ID;
+    frame.len = FirmwareInformationMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.eepromVersion, sizeof(message.eepromVersion));
+    memcpy(&frame.buf[2], &message.softwareVersion, sizeof(message.softwareVersion));
+    memcpy(&frame.buf[4], &message.dateCodeMMDD, sizeof(message.dateCodeMMDD));
+    memcpy(&frame.buf[6], &message.dateCodeYYYY, sizeof(message.dateCodeYYYY));
+}
+
+/** HighSpeedId (0x0B0), 8 bytes, sent by RMS every 3 ms. */
+struct HighSpeedMessage
+{
+    static constexpr ReservedIDs ID = HighSpeedId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float TORQUE_COMMAND_SCALE = 0.1f;
+    static constexpr float TORQUE_COMMAND_OFFSET = 0.0f;
+    static constexpr float TORQUE_FEEDBACK_SCALE = 0.1f;
+    static constexpr float TORQUE_FEEDBACK_OFFSET = 0.0f;
+    static constexpr float DC_BUS_VOLTAGE_SCALE = 0.1f;
+    static constexpr float DC_BUS_VOLTAGE_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, Nm. */
+    int16_t torqueCommand = 0;
+    /** Bits 16-31, raw * 0.1, Nm. */
+    int16_t torqueFeedback = 0;
+    /** Bits 32-47, rpm. */
+    int16_t motorSpeed = 0;
+    /** Bits 48-63, raw * 0.1, V. */
+    int16_t dcBusVoltage = 0;
+
+    /** @return torqueCommand in Nm */
+    [[nodiscard]] float getTorqueCommand() const
+    {
+        return torqueCommand * TORQUE_COMMAND_SCALE + TORQUE_COMMAND_OFFSET;
+    }
+
+    /** <b>Set torqueCommand from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueCommand(const float value)
+    {
+        torqueCommand = static_cast<int16_t>(lroundf((value - TORQUE_COMMAND_OFFSET) / TORQUE_COMMAND_SCALE));
+    }
+
+    /** @return torqueFeedback in Nm */
+    [[nodiscard]] float getTorqueFeedback() const
+    {
+        return torqueFeedback * TORQUE_FEEDBACK_SCALE + TORQUE_FEEDBACK_OFFSET;
+    }
+
+    /** <b>Set torqueFeedback from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueFeedback(const float value)
+    {
+        torqueFeedback = static_cast<int16_t>(lroundf((value - TORQUE_FEEDBACK_OFFSET) / TORQUE_FEEDBACK_SCALE));
+    }
+
+    /** @return dcBusVoltage in V */
+    [[nodiscard]] float getDcBusVoltage() const
+    {
+        return dcBusVoltage * DC_BUS_VOLTAGE_SCALE + DC_BUS_VOLTAGE_OFFSET;
+    }
+
+    /** <b>Set dcBusVoltage from a value in V, rounding to the nearest raw step.</b> */
+    void setDcBusVoltage(const float value)
+    {
+        dcBusVoltage = static_cast<int16_t>(lroundf((value - DC_BUS_VOLTAGE_OFFSET) / DC_BUS_VOLTAGE_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of HighSpeedId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, HighSpeedMessage& message)
+{
+    if (frame.id != HighSpeedMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    memcpy(&message.torqueCommand, &frame.buf[0], sizeof(message.torqueCommand));
+    memcpy(&message.torqueFeedback, &frame.buf[2], sizeof(message.torqueFeedback));
+    memcpy(&message.motorSpeed, &frame.buf[4], sizeof(message.motorSpeed));
+    memcpy(&message.dcBusVoltage, &frame.buf[6], sizeof(message.dcBusVoltage));
+    return true;
+}
+
+/** <b>Pack the signals of HighSpeedId into a frame.</b> */
+inline void pack(const HighSpeedMessage& message, CanFrame& frame)
+{
+    frame.id = HighSpeedMessage::ID;
+    frame.len = HighSpeedMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.torqueCommand, sizeof(message.torqueCommand));
+    memcpy(&frame.buf[2], &message.torqueFeedback, sizeof(message.torqueFeedback));
+    memcpy(&frame.buf[4], &message.motorSpeed, sizeof(message.motorSpeed));
+    memcpy(&frame.buf[6], &message.dcBusVoltage, sizeof(message.dcBusVoltage));
+}
+
+/** TorqueCapabilityId (0x0B1), 2 bytes, sent by RMS. */
+struct TorqueCapabilityMessage
+{
+    static constexpr ReservedIDs ID = TorqueCapabilityId;
+    static constexpr uint8_t DLC = 2;
+    static constexpr float TORQUE_CAPABILITY_SCALE = 0.1f;
+    static constexpr float TORQUE_CAPABILITY_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, Nm. */
+    uint16_t torqueCapability = 0;
+
+    /** @return torqueCapability in Nm */
+    [[nodiscard]] float getTorqueCapability() const
+    {
+        return torqueCapability * TORQUE_CAPABILITY_SCALE + TORQUE_CAPABILITY_OFFSET;
+    }
+
+    /** <b>Set torqueCapability from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueCapability(const float value)
+    {
+        torqueCapability = static_cast<uint16_t>(lroundf((value - TORQUE_CAPABILITY_OFFSET) / TORQUE_CAPABILITY_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of TorqueCapabilityId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, TorqueCapabilityMessage& message)
+{
+    if (frame.id != TorqueCapabilityMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.torqueCapability, &frame.buf[0], sizeof(message.torqueCapability));
+    return true;
+}
+
+/** <b>Pack the signals of TorqueCapabilityId into a frame.</b> */
+inline void pack(const TorqueCapabilityMessage& message, CanFrame& frame)
+{
+    frame.id = TorqueCapabilityMessage::ID;
+    frame.len = TorqueCapabilityMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.torqueCapability, sizeof(message.torqueCapability));
+}
+
+/** ControlCommandId (0x0C0), 8 bytes, sent by VCU every 3 ms. */
+struct ControlCommandMessage
+{
+    static constexpr ReservedIDs ID = ControlCommandId;
+    static constexpr uint8_t DLC = 8;
+    static constexpr float TORQUE_COMMAND_SCALE = 0.1f;
+    static constexpr float TORQUE_COMMAND_OFFSET = 0.0f;
+    static constexpr float TORQUE_LIMIT_SCALE = 0.1f;
+    static constexpr float TORQUE_LIMIT_OFFSET = 0.0f;
+
+    /** Bits 0-15, raw * 0.1, Nm. */
+    int16_t torqueCommand = 0;
+    /** Bits 16-31, rpm. */
+    int16_t speedCommand = 0;
+    /** Bit 32. */
+    bool directionCommand = false;
+    /** Bit 40. */
+    bool inverterEnable = false;
+    /** Bit 41. */
+    bool inverterDischarge = false;
+    /** Bit 42. */
+    bool speedModeEnable = false;
+    /** Bits 48-63, raw * 0.1, Nm. */
+    int16_t torqueLimit = 0;
+
+    /** @return torqueCommand in Nm */
+    [[nodiscard]] float getTorqueCommand() const
+    {
+        return torqueCommand * TORQUE_COMMAND_SCALE + TORQUE_COMMAND_OFFSET;
+    }
+
+    /** <b>Set torqueCommand from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueCommand(const float value)
+    {
+        torqueCommand = static_cast<int16_t>(lroundf((value - TORQUE_COMMAND_OFFSET) / TORQUE_COMMAND_SCALE));
+    }
+
+    /** @return torqueLimit in Nm */
+    [[nodiscard]] float getTorqueLimit() const
+    {
+        return torqueLimit * TORQUE_LIMIT_SCALE + TORQUE_LIMIT_OFFSET;
+    }
+
+    /** <b>Set torqueLimit from a value in Nm, rounding to the nearest raw step.</b> */
+    void setTorqueLimit(const float value)
+    {
+        torqueLimit = static_cast<int16_t>(lroundf((value - TORQUE_LIMIT_OFFSET) / TORQUE_LIMIT_SCALE));
+    }
+};
+
+/**
+ * <b>Unpack the signals of ControlCommandId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 8 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ControlCommandMessage& message)
+{
+    if (frame.id != ControlCommandMessage::ID || frame.len < 8)
+    {
+        return false;
+    }
+    uint64_t word;
+    memcpy(&word, frame.buf, sizeof(word));
+    message.torqueCommand = static_cast<int16_t>(static_cast<int64_t>(word << 48) >> 48);
+    message.speedCommand = static_cast<int16_t>(static_cast<int64_t>(word << 32) >> 48);
+    message.directionCommand = (word >> 32) & 1u;
+    message.inverterEnable = (word >> 40) & 1u;
+    message.inverterDischarge = (word >> 41) & 1u;
+    message.speedModeEnable = (word >> 42) & 1u;
+    message.torqueLimit = static_cast<int16_t>(static_cast<int64_t>(word << 0) >> 48);
+    return true;
+}
+
+/** <b>Pack the signals of ControlCommandId into a frame.</b> */
+inline void pack(const ControlCommandMessage& message, CanFrame& frame)
+{
+    frame.id = ControlCommandMessage::ID;
+    frame.len = ControlCommandMessage::DLC;
+    frame.extended = false;
+    const uint64_t word =
+        (static_cast<uint64_t>(static_cast<uint16_t>(message.torqueCommand)) & 0xFFFFULL)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(message.speedCommand)) & 0xFFFFULL) << 16
+        | (static_cast<uint64_t>(message.directionCommand) & 0x1ULL) << 32
+        | (static_cast<uint64_t>(message.inverterEnable) & 0x1ULL) << 40
+        | (static_cast<uint64_t>(message.inverterDischarge) & 0x1ULL) << 41
+        | (static_cast<uint64_t>(message.speedModeEnable) & 0x1ULL) << 42
+        | (static_cast<uint64_t>(static_cast<uint16_t>(message.torqueLimit)) & 0xFFFFULL) << 48;
+    memcpy(frame.buf, &word, sizeof(word));
+}
+
+/** ParameterCommandId (0x0C1), 8 bytes, sent by VCU. */
+struct ParameterCommandMessage
+{
+    static constexpr ReservedIDs ID = ParameterCommandId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bits 0-15. */
+    uint16_t address = 0;
+    /** Bits 16-23. */
+    uint8_t write = 0;
+    /** Bits 32-47. */
+    uint16_t value = 0;
+};
+
+/**
+ * <b>Unpack the signals of ParameterCommandId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ParameterCommandMessage& message)
+{
+    if (frame.id != ParameterCommandMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.address, &frame.buf[0], sizeof(message.address));
+    memcpy(&message.write, &frame.buf[2], sizeof(message.write));
+    memcpy(&message.value, &frame.buf[4], sizeof(message.value));
+    return true;
+}
+
+/** <b>Pack the signals of ParameterCommandId into a frame.</b> */
+inline void pack(const ParameterCommandMessage& message, CanFrame& frame)
+{
+    frame.id = ParameterCommandMessage::ID;
+    frame.len = ParameterCommandMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.address, sizeof(message.address));
+    memcpy(&frame.buf[2], &message.write, sizeof(message.write));
+    memcpy(&frame.buf[4], &message.value, sizeof(message.value));
+}
+
+/** ParameterResponseId (0x0C2), 8 bytes, sent by RMS. */
+struct ParameterResponseMessage
+{
+    static constexpr ReservedIDs ID = ParameterResponseId;
+    static constexpr uint8_t DLC = 8;
+
+    /** Bits 0-15. */
+    uint16_t address = 0;
+    /** Bits 16-23. */
+    uint8_t writeSuccess = 0;
+    /** Bits 32-47. */
+    uint16_t value = 0;
+};
+
+/**
+ * <b>Unpack the signals of ParameterResponseId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ParameterResponseMessage& message)
+{
+    if (frame.id != ParameterResponseMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.address, &frame.buf[0], sizeof(message.address));
+    memcpy(&message.writeSuccess, &frame.buf[2], sizeof(message.writeSuccess));
+    memcpy(&message.value, &frame.buf[4], sizeof(message.value));
+    return true;
+}
+
+/** <b>Pack the signals of ParameterResponseId into a frame.</b> */
+inline void pack(const ParameterResponseMessage& message, CanFrame& frame)
+{
+    frame.id = ParameterResponseMessage::ID;
+    frame.len = ParameterResponseMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.address, sizeof(message.address));
+    memcpy(&frame.buf[2], &message.writeSuccess, sizeof(message.writeSuccess));
+    memcpy(&frame.buf[4], &message.value, sizeof(message.value));
+}
+
+/** HealthCheckId (0x0C8), 6 bytes, sent by VCU. */
+struct HealthCheckMessage
+{
+    static constexpr ReservedIDs ID = HealthCheckId;
+    static constexpr uint8_t DLC = 6;
+
+    /** Bits 0-15. */
+    uint16_t sequence = 0;
+    /** Bits 16-47, us. */
+    uint32_t timestampUs = 0;
+};
+
+/**
+ * <b>Unpack the signals of HealthCheckId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, HealthCheckMessage& message)
+{
+    if (frame.id != HealthCheckMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.sequence, &frame.buf[0], sizeof(message.sequence));
+    memcpy(&message.timestampUs, &frame.buf[2], sizeof(message.timestampUs));
+    return true;
+}
+
+/** <b>Pack the signals of HealthCheckId into a frame.</b> */
+inline void pack(const HealthCheckMessage& message, CanFrame& frame)
+{
+    frame.id = HealthCheckMessage::ID;
+    frame.len = HealthCheckMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.sequence, sizeof(message.sequence));
+    memcpy(&frame.buf[2], &message.timestampUs, sizeof(message.timestampUs));
+}
+
+/** DCFId (0x0C9), 6 bytes, sent by Sensors. */
+struct DCFMessage
+{
+    static constexpr ReservedIDs ID = DCFId;
+    static constexpr uint8_t DLC = 6;
+
+    /** Bits 0-15. */
+    uint16_t sequence = 0;
+    /** Bits 16-47, us. */
+    uint32_t timestampUs = 0;
+};
+
+/**
+ * <b>Unpack the signals of DCFId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DCFMessage& message)
+{
+    if (frame.id != DCFMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.sequence, &frame.buf[0], sizeof(message.sequence));
+    memcpy(&message.timestampUs, &frame.buf[2], sizeof(message.timestampUs));
+    return true;
+}
+
+/** <b>Pack the signals of DCFId into a frame.</b> */
+inline void pack(const DCFMessage& message, CanFrame& frame)
+{
+    frame.id = DCFMessage::ID;
+    frame.len = DCFMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.sequence, sizeof(message.sequence));
+    memcpy(&frame.buf[2], &message.timestampUs, sizeof(message.timestampUs));
+}
+
+/** DCRId (0x0CA), 6 bytes, sent by Sensors. */
+struct DCRMessage
+{
+    static constexpr ReservedIDs ID = DCRId;
+    static constexpr uint8_t DLC = 6;
+
+    /** Bits 0-15. */
+    uint16_t sequence = 0;
+    /** Bits 16-47, us. */
+    uint32_t timestampUs = 0;
+};
+
+/**
+ * <b>Unpack the signals of DCRId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DCRMessage& message)
+{
+    if (frame.id != DCRMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.sequence, &frame.buf[0], sizeof(message.sequence));
+    memcpy(&message.timestampUs, &frame.buf[2], sizeof(message.timestampUs));
+    return true;
+}
+
+/** <b>Pack the signals of DCRId into a frame.</b> */
+inline void pack(const DCRMessage& message, CanFrame& frame)
+{
+    frame.id = DCRMessage::ID;
+    frame.len = DCRMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.sequence, sizeof(message.sequence));
+    memcpy(&frame.buf[2], &message.timestampUs, sizeof(message.timestampUs));
+}
+
+/** DCTId (0x0CB), 6 bytes, sent by Telemetry. */
+struct DCTMessage
+{
+    static constexpr ReservedIDs ID = DCTId;
+    static constexpr uint8_t DLC = 6;
+
+    /** Bits 0-15. */
+    uint16_t sequence = 0;
+    /** Bits 16-47, us. */
+    uint32_t timestampUs = 0;
+};
+
+/**
+ * <b>Unpack the signals of DCTId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 6 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DCTMessage& message)
+{
+    if (frame.id != DCTMessage::ID || frame.len < 6)
+    {
+        return false;
+    }
+    memcpy(&message.sequence, &frame.buf[0], sizeof(message.sequence));
+    memcpy(&message.timestampUs, &frame.buf[2], sizeof(message.timestampUs));
+    return true;
+}
+
+/** <b>Pack the signals of DCTId into a frame.</b> */
+inline void pack(const DCTMessage& message, CanFrame& frame)
+{
+    frame.id = DCTMessage::ID;
+    frame.len = DCTMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.sequence, sizeof(message.sequence));
+    memcpy(&frame.buf[2], &message.timestampUs, sizeof(message.timestampUs));
+}
+
+/** FaultId (0x0CC), 3 bytes, sent by VCU every 100 ms. */
+struct FaultMessage
+{
+    static constexpr ReservedIDs ID = FaultId;
+    static constexpr uint8_t DLC = 3;
+
+    /** Bits 0-7. */
+    uint8_t activeMask = 0;
+    /** Bits 8-15. */
+    uint8_t latchedMask = 0;
+    /** Bits 16-23. */
+    uint8_t version = 0;
+};
+
+/**
+ * <b>Unpack the signals of FaultId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 3 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, FaultMessage& message)
+{
+    if (frame.id != FaultMessage::ID || frame.len < 3)
+    {
+        return false;
+    }
+    memcpy(&message.activeMask, &frame.buf[0], sizeof(message.activeMask));
+    memcpy(&message.latchedMask, &frame.buf[1], sizeof(message.latchedMask));
+    memcpy(&message.version, &frame.buf[2], sizeof(message.version));
+    return true;
+}
+
+/** <b>Pack the signals of FaultId into a frame.</b> */
+inline void pack(const FaultMessage& message, CanFrame& frame)
+{
+    frame.id = FaultMessage::ID;
+    frame.len = FaultMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.activeMask, sizeof(message.activeMask));
+    memcpy(&frame.buf[1], &message.latchedMask, sizeof(message.latchedMask));
+    memcpy(&frame.buf[2], &message.version, sizeof(message.version));
+}
+
+/** DriveStateId (0x0CD), 1 bytes, sent by VCU every 100 ms. */
+struct DriveStateMessage
+{
+    static constexpr ReservedIDs ID = DriveStateId;
+    static constexpr uint8_t DLC = 1;
+
+    /** Bits 0-7. */
+    uint8_t state = 0;
+};
+
+/**
+ * <b>Unpack the signals of DriveStateId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 1 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DriveStateMessage& message)
+{
+    if (frame.id != DriveStateMessage::ID || frame.len < 1)
+    {
+        return false;
+    }
+    memcpy(&message.state, &frame.buf[0], sizeof(message.state));
+    return true;
+}
+
+/** <b>Pack the signals of DriveStateId into a frame.</b> */
+inline void pack(const DriveStateMessage& message, CanFrame& frame)
+{
+    frame.id = DriveStateMessage::ID;
+    frame.len = DriveStateMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.state, sizeof(message.state));
+}
+
+/** DriveModeId (0x0CE), 1 bytes, sent by Dash. */
+struct DriveModeMessage
+{
+    static constexpr ReservedIDs ID = DriveModeId;
+    static constexpr uint8_t DLC = 1;
+
+    /** Bits 0-7. */
+    uint8_t mode = 0;
+};
+
+/**
+ * <b>Unpack the signals of DriveModeId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 1 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, DriveModeMessage& message)
+{
+    if (frame.id != DriveModeMessage::ID || frame.len < 1)
+    {
+        return false;
+    }
+    memcpy(&message.mode, &frame.buf[0], sizeof(message.mode));
+    return true;
+}
+
+/** <b>Pack the signals of DriveModeId into a frame.</b> */
+inline void pack(const DriveModeMessage& message, CanFrame& frame)
+{
+    frame.id = DriveModeMessage::ID;
+    frame.len = DriveModeMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.mode, sizeof(message.mode));
+}
+
+/** ThrottleMinId (0x0CF), 2 bytes, sent by Dash. */
+struct ThrottleMinMessage
+{
+    static constexpr ReservedIDs ID = ThrottleMinId;
+    static constexpr uint8_t DLC = 2;
+
+    /** Bits 0-15. */
+    uint16_t raw = 0;
+};
+
+/**
+ * <b>Unpack the signals of ThrottleMinId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ThrottleMinMessage& message)
+{
+    if (frame.id != ThrottleMinMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.raw, &frame.buf[0], sizeof(message.raw));
+    return true;
+}
+
+/** <b>Pack the signals of ThrottleMinId into a frame.</b> */
+inline void pack(const ThrottleMinMessage& message, CanFrame& frame)
+{
+    frame.id = ThrottleMinMessage::ID;
+    frame.len = ThrottleMinMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.raw, sizeof(message.raw));
+}
+
+/** ThrottleMaxId (0x0D0), 2 bytes, sent by Dash. */
+struct ThrottleMaxMessage
+{
+    static constexpr ReservedIDs ID = ThrottleMaxId;
+    static constexpr uint8_t DLC = 2;
+
+    /** Bits 0-15. */
+    uint16_t raw = 0;
+};
+
+/**
+ * <b>Unpack the signals of ThrottleMaxId.</b>
+ *
+ * @return false if the frame has a different ID or is shorter than 2 bytes, true otherwise
+ */
+inline bool unpack(const CanFrame& frame, ThrottleMaxMessage& message)
+{
+    if (frame.id != ThrottleMaxMessage::ID || frame.len < 2)
+    {
+        return false;
+    }
+    memcpy(&message.raw, &frame.buf[0], sizeof(message.raw));
+    return true;
+}
+
+/** <b>Pack the signals of ThrottleMaxId into a frame.</b> */
+inline void pack(const ThrottleMaxMessage& message, CanFrame& frame)
+{
+    frame.id = ThrottleMaxMessage::ID;
+    frame.len = ThrottleMaxMessage::DLC;
+    frame.extended = false;
+    memset(frame.buf, 0, sizeof(frame.buf));
+    memcpy(&frame.buf[0], &message.raw, sizeof(message.raw));
+}
+
+#endif //MESSAGECODECS_H
@@ -0,0 +1,270 @@
+#ifndef MUXCODEC_H
+#define MUXCODEC_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/**
+ * <b>Codec for multiplexed frames, where the first byte selects the layout of the rest.</b>
+ *
+ * Some reserved IDs carry several signals that share one arbitration ID (RVCId carries RVCSubIDs, TireRPMId and
+ * TireTemperatureId carry TireSubIDs). The first payload byte is the mux byte:
+ *
+ * - <b>single</b> frames (bit 7 clear): the mux byte is the sub-ID, followed by that sub-ID's value
+ * - <b>batched</b> frames (bit 7 set): bits 0-3 hold the first sub-ID and bits 4-6 hold the value count minus one,
+ *   followed by that many values for consecutive sub-IDs
+ *
+ * Decoding goes through a per-sub-ID jump table of decode functions into a per-sub-ID slot array, so consumers read
+ * the latest value of each sub-ID instead of branching on the mux byte themselves. Every sub-ID uses
+ * BufferPacker::pack<T>() / unpack<T>() by default; setLayout() swaps in a custom layout for a single sub-ID.
+ *
+ * <code>
+ * TireRpmCodec tireRpm;
+ * tireRpm.decode(frame);
+ * const uint16_t frontLeft = tireRpm.getSlot(FrontLeftId);
+ * </code>
+ * @tparam SUB_ID the sub-ID enum carried in the mux byte
+ * @tparam SUB_COUNT the number of sub-IDs; at most 16
+ * @tparam T the decoded value type stored in each slot
+ */
+template <typename SUB_ID, size_t SUB_COUNT, typename T> class MuxCodec
+{
+    static_assert(SUB_COUNT > 0 && SUB_COUNT <= 16, "MuxCodec supports between 1 and 16 sub-IDs");
+
+public:
+    /** Packs one slot value after the mux byte. */
+    using EncodeFn = void (*)(BufferPacker<CAN_MAX_DLC>& packer, const T& value);
+    /** Unpacks one slot value from after the mux byte. */
+    using DecodeFn = void (*)(BufferPacker<CAN_MAX_DLC>& unpacker, T& value);
+
+    /** A MuxCodec starts with every sub-ID using the default pack<T>() / unpack<T>() layout. */
+    MuxCodec()
+    {
+        for (size_t i = 0; i < SUB_COUNT; i++)
+        {
+            m_Layouts[i] = {defaultEncode, defaultDecode, sizeof(T)};
+        }
+    }
+
+    /**
+     * <b>Replace the payload layout of a single sub-ID.</b>
+     *
+     * @param sub the sub-ID whose layout to replace
+     * @param encode the function that packs a value of this sub-ID
+     * @param decode the function that unpacks a value of this sub-ID
+     * @param encodedSize the number of bytes encode writes; used to fit values into batched frames
+     */
+    void setLayout(const SUB_ID sub, const EncodeFn encode, const DecodeFn decode, const uint8_t encodedSize)
+    {
+        if (static_cast<size_t>(sub) < SUB_COUNT)
+        {
+            m_Layouts[sub] = {encode, decode, encodedSize};
+        }
+    }
+
+    /**
+     * <b>Decode a multiplexed frame into the slot array.</b>
+     *
+     * This method can return false if either:
+     * - the mux byte names a sub-ID past SUB_COUNT
+     * - the payload is shorter than the layout(s) it selects
+     *
+     * Slots decoded before a failure keep their new values.
+     *
+     * @param frame the received frame
+     * @return true if every value in the frame was decoded, false otherwise
+     */
+    bool decode(const CanFrame& frame)
+    {
+        auto unpacker = frame.unpacker();
+        const auto mux = unpacker.template unpack<uint8_t>();
+        if (!unpacker)
+        {
+            return false;
+        }
+        size_t first = mux;
+        size_t count = 1;
+        if (mux & BATCH_FLAG)
+        {
+            first = mux & 0x0F;
+            count = ((mux >> 4) & 0x07) + 1;
+        }
+        if (first + count > SUB_COUNT)
+        {
+            return false;
+        }
+        for (size_t sub = first; sub < first + count; sub++)
+        {
+            m_Layouts[sub].decode(unpacker, m_Slots[sub]);
+            if (!unpacker)
+            {
+                return false;
+            }
+            m_UpdatedMask |= static_cast<uint16_t>(1u << sub);
+        }
+        return true;
+    }
+
+    /**
+     * <b>Encode a single sub-ID's slot value into a frame.</b>
+     *
+     * @param id the arbitration ID to give the frame
+     * @param sub the sub-ID to encode
+     * @param frame the frame to pack into
+     * @return false if sub is out of range or the value doesn't fit, true otherwise
+     */
+    bool encode(const uint32_t id, const SUB_ID sub, CanFrame& frame) const
+    {
+        if (static_cast<size_t>(sub) >= SUB_COUNT)
+        {
+            return false;
+        }
+        BufferPacker<CAN_MAX_DLC> packer;
+        packer.reset();
+        packer.pack(static_cast<uint8_t>(sub));
+        m_Layouts[sub].encode(packer, m_Slots[sub]);
+        return frame.pack(id, packer);
+    }
+
+    /**
+     * <b>Encode as many consecutive slot values as fit into one batched frame.</b>
+     *
+     * <code>
+     * for (size_t next = 0; next < TIRE_SUB_COUNT;) { next = codec.encodeBatch(TireRPMId, next, frame); send(frame); }
+     * </code>
+     * @param id the arbitration ID to give the frame
+     * @param first the first sub-ID to encode
+     * @param frame the frame to pack into
+     * @return The sub-ID to start the next batch at; equal to first if nothing could be encoded
+     */
+    size_t encodeBatch(const uint32_t id, const size_t first, CanFrame& frame) const
+    {
+        size_t used = 1;
+        size_t count = 0;
+        while (first + count < SUB_COUNT && count < MAX_BATCH && used + m_Layouts[first + count].encodedSize <= CAN_MAX_DLC)
+        {
+            used += m_Layouts[first + count].encodedSize;
+            count++;
+        }
+        if (count == 0)
+        {
+            return first;
+        }
+        BufferPacker<CAN_MAX_DLC> packer;
+        packer.reset();
+        packer.pack(static_cast<uint8_t>(BATCH_FLAG | ((count - 1) << 4) | first));
+        for (size_t sub = first; sub < first + count; sub++)
+        {
+            m_Layouts[sub].encode(packer, m_Slots[sub]);
+        }
+        if (!frame.pack(id, packer))
+        {
+            return first;
+        }
+        return first + count;
+    }
+
+    /**
+     * <b>Encode every slot value into as few batched frames as possible.</b>
+     *
+     * @tparam MAX_FRAMES the number of frames available
+     * @param id the arbitration ID to give the frames
+     * @param frames the frames to pack into, in order
+     * @return The number of frames used; 0 if the slots don't fit into MAX_FRAMES frames
+     */
+    template <size_t MAX_FRAMES> size_t encodeAll(const uint32_t id, CanFrame (&frames)[MAX_FRAMES]) const
+    {
+        size_t next = 0;
+        size_t used = 0;
+        while (next < SUB_COUNT)
+        {
+            if (used >= MAX_FRAMES)
+            {
+                return 0;
+            }
+            const size_t after = encodeBatch(id, next, frames[used]);
+            if (after == next)
+            {
+                return 0;
+            }
+            next = after;
+            used++;
+        }
+        return used;
+    }
+
+    /** @return the latest value of a sub-ID; a default T if it was never decoded or set */
+    [[nodiscard]] const T& getSlot(const SUB_ID sub) const
+    {
+        return m_Slots[static_cast<size_t>(sub) < SUB_COUNT ? sub : 0];
+    }
+
+    /** <b>Set the value of a sub-ID to be encoded.</b> */
+    void setSlot(const SUB_ID sub, const T& value)
+    {
+        if (static_cast<size_t>(sub) < SUB_COUNT)
+        {
+            m_Slots[sub] = value;
+        }
+    }
+
+    /** @return a bitmask with bit n set if sub-ID n was decoded since the last clearUpdated() */
+    [[nodiscard]] uint16_t getUpdatedMask() const
+    {
+        return m_UpdatedMask;
+    }
+
+    /** <b>Clear the mask returned by getUpdatedMask().</b> */
+    void clearUpdated()
+    {
+        m_UpdatedMask = 0;
+    }
+
+private:
+    /** Mux byte flag marking a batched frame. */
+    static constexpr uint8_t BATCH_FLAG = 0x80;
+    /** Largest number of values a batched mux byte can describe. */
+    static constexpr size_t MAX_BATCH = 8;
+
+    /** Entry of the per-sub-ID jump table. */
+    struct Layout
+    {
+        EncodeFn encode;
+        DecodeFn decode;
+        uint8_t encodedSize;
+    };
+
+    static void defaultEncode(BufferPacker<CAN_MAX_DLC>& packer, const T& value)
+    {
+        packer.pack(value);
+    }
+
+    static void defaultDecode(BufferPacker<CAN_MAX_DLC>& unpacker, T& value)
+    {
+        value = unpacker.template unpack<T>();
+    }
+
+    /** Jump table of layouts, indexed by sub-ID. */
+    Layout m_Layouts[SUB_COUNT];
+    /** Latest value of each sub-ID, indexed by sub-ID. */
+    T m_Slots[SUB_COUNT] = {};
+    /** Bit n is set when sub-ID n is decoded. */
+    uint16_t m_UpdatedMask = 0;
+};
+
+/** Number of RVCSubIDs. */
+constexpr size_t RVC_SUB_COUNT = YawId + 1;
+/** Number of TireSubIDs. */
+constexpr size_t TIRE_SUB_COUNT = RearRightId + 1;
+
+/** RVCId accelerations and orientation angles, one float per sub-ID. */
+using RvcCodec = MuxCodec<RVCSubIDs, RVC_SUB_COUNT, float>;
+/** TireRPMId wheel speeds in RPM, one uint16_t per tire; all four tires fit in two batched frames. */
+using TireRpmCodec = MuxCodec<TireSubIDs, TIRE_SUB_COUNT, uint16_t>;
+/** TireTemperatureId temperatures in tenths of a degree Celsius, one int16_t per tire. */
+using TireTemperatureCodec = MuxCodec<TireSubIDs, TIRE_SUB_COUNT, int16_t>;
+
+#endif //MUXCODEC_H
@@ -0,0 +1,322 @@
+#ifndef PARAMETERCLIENT_H
+#define PARAMETERCLIENT_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/** Outcome of a parameter read or write. */
+enum class ParameterStatus : uint8_t
+{
+    /** The motor controller answered; for writes, it also accepted the value. */
+    Ok,
+    /** The motor controller answered a write but rejected the value. */
+    Rejected,
+    /** No answer arrived after every retry. */
+    TimedOut,
+};
+
+/**
+ * <b>Pipelined client for the motor controller's ParameterCommandId / ParameterResponseId messages.</b>
+ *
+ * Instead of waiting for each answer before asking the next question, requests are queued and up to WINDOW of them
+ * are kept on the bus at once. Responses are matched to their request by parameter address, requests that go
+ * unanswered are retried, and every finished request is reported through a completion callback.
+ *
+ * Command payload: uint16_t address, uint8_t write flag, uint8_t reserved, uint16_t value, uint16_t reserved.
+ * Response payload: uint16_t address, uint8_t write success, uint8_t reserved, uint16_t value, uint16_t reserved.
+ *
+ * Only one request per address is put on the bus at a time, since responses can't be told apart otherwise; later
+ * requests for the same address wait in the queue.
+ *
+ * <code>
+ * ParameterClient<4, 32> params(onParameterDone, nullptr, 20000, 3);
+ * for (uint16_t address : STARTUP_PARAMETERS) { params.read(address); }
+ * ...
+ * params.handleResponse(rxFrame, micros());
+ * params.poll(micros(), txRing);
+ * </code>
+ * @tparam WINDOW the maximum number of requests on the bus at once
+ * @tparam QUEUE_SIZE the maximum number of requests waiting for a free window slot
+ */
+template <size_t WINDOW = 4, size_t QUEUE_SIZE = 32> class ParameterClient
+{
+    static_assert(WINDOW > 0, "ParameterClient needs a window of at least one request");
+    static_assert(QUEUE_SIZE > 0, "ParameterClient needs room to queue at least one request");
+
+public:
+    /** Called once per request when it finishes; value is the value the motor controller reported. */
+    using CompletionCallback = void (*)(uint16_t address, bool write, ParameterStatus status, uint16_t value, void* context);
+
+    /**
+     * @param onComplete the callback invoked when a request finishes
+     * @param context opaque pointer handed back to onComplete
+     * @param timeoutUs how long, in microseconds, to wait for a response before retrying
+     * @param maxRetries how many times a request is resent before it is reported as TimedOut
+     */
+    ParameterClient(const CompletionCallback onComplete, void* context, const uint32_t timeoutUs, const uint8_t maxRetries)
+        : m_OnComplete(onComplete), m_Context(context), m_TimeoutUs(timeoutUs), m_MaxRetries(maxRetries)
+    {
+    }
+
+    /**
+     * <b>Queue a parameter read.</b>
+     *
+     * @param address the parameter address
+     * @return false if the queue is full, true otherwise
+     */
+    bool read(const uint16_t address)
+    {
+        return enqueue(address, false, 0);
+    }
+
+    /**
+     * <b>Queue a parameter write.</b>
+     *
+     * @param address the parameter address
+     * @param value the value to write
+     * @return false if the queue is full, true otherwise
+     */
+    bool write(const uint16_t address, const uint16_t value)
+    {
+        return enqueue(address, true, value);
+    }
+
+    /**
+     * <b>Match a ParameterResponseId frame to the in-flight request for its address.</b>
+     *
+     * @param frame the received frame
+     * @param nowUs the current time in microseconds (unused, kept for symmetry with poll())
+     * @return true if the frame finished an in-flight request, false otherwise
+     */
+    bool handleResponse(const CanFrame& frame, const uint32_t nowUs)
+    {
+        (void)nowUs;
+        if (frame.id != ParameterResponseId)
+        {
+            return false;
+        }
+        auto unpacker = frame.unpacker();
+        const auto address = unpacker.unpack<uint16_t>();
+        const auto success = unpacker.unpack<uint8_t>();
+        unpacker.skip<uint8_t>();
+        const auto value = unpacker.unpack<uint16_t>();
+        if (!unpacker)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < WINDOW; i++)
+        {
+            InFlight& slot = m_InFlight[i];
+            if (slot.used && slot.request.address == address)
+            {
+                const ParameterStatus status = slot.request.write && !success ? ParameterStatus::Rejected : ParameterStatus::Ok;
+                slot.used = false;
+                m_InFlightCount--;
+                finish(slot.request, status, value);
+                return true;
+            }
+        }
+        m_Unmatched++;
+        return false;
+    }
+
+    /**
+     * <b>Resend timed-out requests and put queued requests on the bus while the window has room.</b>
+     *
+     * @tparam TX_QUEUE any queue with FrameRing's acquire()/commit() producer interface
+     * @param nowUs the current time in microseconds
+     * @param txQueue the queue to pack ParameterCommandId frames into
+     */
+    template <typename TX_QUEUE> void poll(const uint32_t nowUs, TX_QUEUE& txQueue)
+    {
+        for (size_t i = 0; i < WINDOW; i++)
+        {
+            InFlight& slot = m_InFlight[i];
+            if (!slot.used || nowUs - slot.sentUs < m_TimeoutUs)
+            {
+                continue;
+            }
+            if (slot.retries >= m_MaxRetries)
+            {
+                slot.used = false;
+                m_InFlightCount--;
+                finish(slot.request, ParameterStatus::TimedOut, 0);
+                continue;
+            }
+            if (send(slot.request, txQueue))
+            {
+                slot.retries++;
+                slot.sentUs = nowUs;
+                m_Retries++;
+            }
+        }
+
+        // Issue queued requests in order, skipping addresses that are already on the bus
+        size_t scanned = 0;
+        while (m_InFlightCount < WINDOW && scanned < m_QueueCount)
+        {
+            const size_t queueIndex = (m_QueueHead + scanned) % QUEUE_SIZE;
+            const Request request = m_Queue[queueIndex];
+            if (isInFlight(request.address))
+            {
+                scanned++;
+                continue;
+            }
+            if (!send(request, txQueue))
+            {
+                // TX queue is full - try again on the next poll()
+                return;
+            }
+            removeQueued(scanned);
+            for (size_t i = 0; i < WINDOW; i++)
+            {
+                if (!m_InFlight[i].used)
+                {
+                    m_InFlight[i] = {request, nowUs, 0, true};
+                    m_InFlightCount++;
+                    break;
+                }
+            }
+        }
+    }
+
+    /** @return true if no requests are queued or in flight */
+    [[nodiscard]] bool idle() const
+    {
+        return m_QueueCount == 0 && m_InFlightCount == 0;
+    }
+
+    /** @return the number of requests on the bus */
+    [[nodiscard]] size_t getInFlightCount() const
+    {
+        return m_InFlightCount;
+    }
+
+    /** @return the number of requests waiting for a free window slot */
+    [[nodiscard]] size_t getQueuedCount() const
+    {
+        return m_QueueCount;
+    }
+
+    /** @return the number of times a request was resent after a timeout */
+    [[nodiscard]] uint32_t getRetryCount() const
+    {
+        return m_Retries;
+    }
+
+    /** @return the number of responses that didn't match an in-flight request */
+    [[nodiscard]] uint32_t getUnmatchedCount() const
+    {
+        return m_Unmatched;
+    }
+
+private:
+    /** A queued or in-flight request. */
+    struct Request
+    {
+        uint16_t address;
+        bool write;
+        uint16_t value;
+    };
+
+    /** A window slot holding a request that is on the bus. */
+    struct InFlight
+    {
+        Request request;
+        uint32_t sentUs;
+        uint8_t retries;
+        bool used;
+    };
+
+    bool enqueue(const uint16_t address, const bool write, const uint16_t value)
+    {
+        if (m_QueueCount >= QUEUE_SIZE)
+        {
+            return false;
+        }
+        m_Queue[(m_QueueHead + m_QueueCount) % QUEUE_SIZE] = {address, write, value};
+        m_QueueCount++;
+        return true;
+    }
+
+    /** Remove the queued request at position index (0 is the oldest), keeping the rest in order. */
+    void removeQueued(const size_t index)
+    {
+        for (size_t i = index; i > 0; i--)
+        {
+            m_Queue[(m_QueueHead + i) % QUEUE_SIZE] = m_Queue[(m_QueueHead + i - 1) % QUEUE_SIZE];
+        }
+        m_QueueHead = (m_QueueHead + 1) % QUEUE_SIZE;
+        m_QueueCount--;
+    }
+
+    bool isInFlight(const uint16_t address) const
+    {
+        for (size_t i = 0; i < WINDOW; i++)
+        {
+            if (m_InFlight[i].used && m_InFlight[i].request.address == address)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename TX_QUEUE> static bool send(const Request& request, TX_QUEUE& txQueue)
+    {
+        CanFrame* mailbox = txQueue.acquire();
+        if (mailbox == nullptr)
+        {
+            return false;
+        }
+        BufferPacker<CAN_MAX_DLC> packer;
+        packer.pack(request.address);
+        packer.pack(static_cast<uint8_t>(request.write));
+        packer.pack(static_cast<uint8_t>(0));
+        packer.pack(request.value);
+        packer.pack(static_cast<uint16_t>(0));
+        *mailbox = CanFrame{};
+        if (!mailbox->pack(ParameterCommandId, packer))
+        {
+            return false;
+        }
+        txQueue.commit();
+        return true;
+    }
+
+    void finish(const Request& request, const ParameterStatus status, const uint16_t value)
+    {
+        if (m_OnComplete != nullptr)
+        {
+            m_OnComplete(request.address, request.write, status, value, m_Context);
+        }
+    }
+
+    /** Callback invoked when a request finishes. */
+    CompletionCallback m_OnComplete;
+    /** Opaque pointer handed back to m_OnComplete. */
+    void* m_Context;
+    /** How long, in microseconds, to wait for a response before retrying. */
+    uint32_t m_TimeoutUs;
+    /** How many times a request is resent before it times out. */
+    uint8_t m_MaxRetries;
+    /** Requests on the bus. */
+    InFlight m_InFlight[WINDOW] = {};
+    /** Number of used entries in m_InFlight. */
+    size_t m_InFlightCount = 0;
+    /** Ring of requests waiting for a window slot. */
+    Request m_Queue[QUEUE_SIZE] = {};
+    /** Index of the oldest queued request. */
+    size_t m_QueueHead = 0;
+    /** Number of queued requests. */
+    size_t m_QueueCount = 0;
+    /** Number of resends after a timeout. */
+    uint32_t m_Retries = 0;
+    /** Number of responses that didn't match an in-flight request. */
+    uint32_t m_Unmatched = 0;
+};
+
+#endif //PARAMETERCLIENT_H
@@ -0,0 +1,123 @@
+#ifndef PEDALBOX_H
+#define PEDALBOX_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "MessageCodecs.h"
+
+/** How a pedal box puts its samples on the bus. */
+enum class PedalBoxMode : uint8_t
+{
+    /** One frame each for StartSwitchId, Throttle1PositionId, Throttle2PositionId and BrakePressureId. */
+    PerId,
+    /** A single PedalBoxId frame carrying all four signals. */
+    Coalesced,
+};
+
+/** Number of per-ID frames a PedalBoxId frame stands in for. */
+constexpr size_t PEDAL_BOX_FRAME_COUNT = 4;
+
+/** One control-cycle sample of every pedal box input, as raw 12-bit ADC counts. */
+struct PedalBoxSample
+{
+    bool startSwitch = false;
+    uint16_t throttle1 = 0;
+    uint16_t throttle2 = 0;
+    uint16_t brakePressure = 0;
+};
+
+/**
+ * <b>Put a pedal box sample on the bus as either one PedalBoxId frame or four per-ID frames.</b>
+ *
+ * The coalesced frame packs the three ADC channels into 12 bits each, saturating anything above 4095, and adds a
+ * rolling counter so receivers can spot lost or repeated frames. Sampling all four inputs into one frame costs one
+ * arbitration slot and one frame overhead per control cycle instead of four.
+ *
+ * <code>
+ * PedalBoxSample sample{digitalRead(START), analogRead(APPS1), analogRead(APPS2), analogRead(BPS)};
+ * CanFrame frames[PEDAL_BOX_FRAME_COUNT];
+ * const size_t count = packPedalBox(sample, PedalBoxMode::Coalesced, counter++, micros(), frames);
+ * </code>
+ * @param sample the inputs to send
+ * @param mode whether to send one coalesced frame or four per-ID frames
+ * @param counter the rolling counter for the coalesced frame; ignored for PerId
+ * @param timestamp the sample time, copied into every frame
+ * @param frames receives the frames to send
+ * @return The number of frames written to frames: 1 for Coalesced, 4 for PerId
+ */
+inline size_t packPedalBox(const PedalBoxSample& sample, const PedalBoxMode mode, const uint8_t counter,
+                           const uint32_t timestamp, CanFrame (&frames)[PEDAL_BOX_FRAME_COUNT])
+{
+    constexpr uint16_t ADC_MAX = 0xFFF;
+    size_t count = 0;
+    if (mode == PedalBoxMode::Coalesced)
+    {
+        PedalBoxMessage message;
+        message.startSwitch = sample.startSwitch;
+        message.throttle1 = sample.throttle1 < ADC_MAX ? sample.throttle1 : ADC_MAX;
+        message.throttle2 = sample.throttle2 < ADC_MAX ? sample.throttle2 : ADC_MAX;
+        message.brakePressure = sample.brakePressure < ADC_MAX ? sample.brakePressure : ADC_MAX;
+        message.counter = counter;
+        pack(message, frames[count++]);
+    }
+    else
+    {
+        StartSwitchMessage startSwitch;
+        startSwitch.pressed = sample.startSwitch;
+        pack(startSwitch, frames[count++]);
+
+        Throttle1PositionMessage throttle1;
+        throttle1.position = sample.throttle1;
+        pack(throttle1, frames[count++]);
+
+        Throttle2PositionMessage throttle2;
+        throttle2.position = sample.throttle2;
+        pack(throttle2, frames[count++]);
+
+        BrakePressureMessage brakePressure;
+        brakePressure.pressure = sample.brakePressure;
+        pack(brakePressure, frames[count++]);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        frames[i].timestamp = timestamp;
+    }
+    return count;
+}
+
+/**
+ * <b>Fan a PedalBoxId frame back out into the four per-ID frames existing consumers expect.</b>
+ *
+ * The per-ID frames are bit-for-bit what packPedalBox() sends in PerId mode, with the coalesced frame's timestamp,
+ * so they can be handed to a MessageBus, StalenessWatchdog or anything else keyed by the individual IDs.
+ *
+ * <code>
+ * CanFrame frames[PEDAL_BOX_FRAME_COUNT];
+ * const size_t count = expandPedalBox(rxFrame, frames);
+ * for (size_t i = 0; i < count; i++) { bus.publish(frames[i]); }
+ * </code>
+ * @param frame a received frame
+ * @param frames receives the per-ID frames
+ * @param counter receives the rolling counter of the coalesced frame, if not nullptr
+ * @return The number of frames written to frames; 0 if frame isn't a valid PedalBoxId frame
+ */
+inline size_t expandPedalBox(const CanFrame& frame, CanFrame (&frames)[PEDAL_BOX_FRAME_COUNT],
+                             uint8_t* counter = nullptr)
+{
+    PedalBoxMessage message;
+    if (!unpack(frame, message))
+    {
+        return 0;
+    }
+    if (counter != nullptr)
+    {
+        *counter = message.counter;
+    }
+    const PedalBoxSample sample{message.startSwitch, message.throttle1, message.throttle2, message.brakePressure};
+    return packPedalBox(sample, PedalBoxMode::PerId, 0, frame.timestamp, frames);
+}
+
+#endif //PEDALBOX_H
@@ -0,0 +1,231 @@
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__arm__)
+#include <time.h>
+#endif
+
+/**
+ * Set to 1 (e.g. -DPROBES_ENABLED=1 in build_flags) to compile the PROBE_ macros in; when 0, the default, they expand
+ * to nothing and cost neither code nor time.
+ */
+#ifndef PROBES_ENABLED
+#define PROBES_ENABLED 0
+#endif
+
+/**
+ * @return the free-running probe clock, wrapping at 32 bits: CPU cycles from the DWT cycle counter on the Teensy 4.1
+ * (600 per microsecond at the default clock), the time-stamp counter on x86 hosts, nanoseconds on other hosts
+ */
+inline uint32_t probeTicks()
+{
+#if defined(__arm__)
+    // Read the Cortex-M7 DWT unit directly, so no core header is needed
+    return *reinterpret_cast<volatile uint32_t*>(0xE0001004); // DWT_CYCCNT
+#elif defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint32_t>(__rdtsc());
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(static_cast<uint64_t>(now.tv_sec) * 1000000000u + now.tv_nsec);
+#endif
+}
+
+/**
+ * <b>Start the probe clock.</b>
+ *
+ * The Teensy core already enables the DWT cycle counter at startup; call this from setup() on other Cortex-M boards.
+ * Does nothing on the host.
+ */
+inline void probeClockBegin()
+{
+#if defined(__arm__)
+    *reinterpret_cast<volatile uint32_t*>(0xE000EDFC) |= 1u << 24; // DEMCR.TRCENA
+    *reinterpret_cast<volatile uint32_t*>(0xE0001000) |= 1u;       // DWT_CTRL.CYCCNTENA
+#endif
+}
+
+/**
+ * @return the fewest ticks measured between two back-to-back probeTicks() reads, i.e. what every probe adds to its
+ * own measurement; subtract it when timing sections only a few cycles long
+ */
+inline uint32_t probeOverheadTicks()
+{
+    uint32_t overhead = UINT32_MAX;
+    for (int i = 0; i < 64; i++)
+    {
+        const uint32_t start = probeTicks();
+        const uint32_t ticks = probeTicks() - start;
+        overhead = ticks < overhead ? ticks : overhead;
+    }
+    return overhead;
+}
+
+/** Timing statistics of a single probe, in probe clock ticks. */
+template <size_t HISTOGRAM_BUCKETS> struct ProbeStats
+{
+    /** Number of times the probed section ran. */
+    uint32_t count = 0;
+    /** Shortest run. */
+    uint32_t minTicks = UINT32_MAX;
+    /** Longest run. */
+    uint32_t maxTicks = 0;
+    /** Sum of all runs; divide by count for the mean. */
+    uint64_t totalTicks = 0;
+    /** Bucket n counts runs of [2^n, 2^(n+1)) ticks; the last bucket also holds everything longer. */
+    uint32_t histogram[HISTOGRAM_BUCKETS] = {};
+};
+
+/**
+ * <b>Per-probe min/max/mean/histogram table for timing hot-path sections in place.</b>
+ *
+ * Probes are indices into the table, usually from an enum. Recording a run is a compare for min and max, an add and
+ * a count-leading-zeros for the histogram bucket, so a probe adds only a few cycles on top of the two counter reads.
+ * Nothing is allocated and nothing is printed; read the statistics with getStats() whenever convenient, e.g. once a
+ * second, and reset() them afterwards for per-interval numbers.
+ *
+ * Sections are timed with PROBE_SCOPE(), which compiles out completely unless PROBES_ENABLED is 1:
+ *
+ * <code>
+ * enum LoopProbe : size_t { RxDecodeProbe, FaultCheckProbe, TxPackProbe, LOOP_PROBE_COUNT };
+ * ProbeTable<LOOP_PROBE_COUNT> loopProbes;
+ *
+ * void loop()
+ * {
+ *     {
+ *         PROBE_SCOPE(loopProbes, RxDecodeProbe);
+ *         rxRing.drain([](const CanFrame& frame) { bus.publish(frame); });
+ *     }
+ *     ...
+ * }
+ * </code>
+ * @tparam PROBES the number of probes
+ * @tparam HISTOGRAM_BUCKETS the number of power-of-two buckets per probe; defaults to 24 (up to ~28 ms at 600 MHz)
+ */
+template <size_t PROBES, size_t HISTOGRAM_BUCKETS = 24> class ProbeTable
+{
+    static_assert(PROBES > 0, "ProbeTable needs at least one probe");
+    static_assert(HISTOGRAM_BUCKETS > 0 && HISTOGRAM_BUCKETS <= 32, "ProbeTable supports 1 to 32 buckets");
+
+public:
+    /** Statistics type kept for each probe. */
+    using Stats = ProbeStats<HISTOGRAM_BUCKETS>;
+
+    ProbeTable() = default;
+
+    // Delete copy and move constructors/operators
+
+    ProbeTable(const ProbeTable&) = delete;
+    ProbeTable& operator=(const ProbeTable&) = delete;
+    ProbeTable(ProbeTable&&) = delete;
+    ProbeTable& operator=(ProbeTable&&) = delete;
+
+    /**
+     * <b>Record one run of a probed section.</b>
+     *
+     * @param probe the probe index
+     * @param ticks the duration of the run in probe clock ticks
+     * @return false if the probe doesn't exist, true otherwise
+     */
+    bool record(const size_t probe, const uint32_t ticks)
+    {
+        if (probe >= PROBES)
+        {
+            return false;
+        }
+        Stats& stats = m_Stats[probe];
+        stats.count++;
+        stats.totalTicks += ticks;
+        stats.minTicks = ticks < stats.minTicks ? ticks : stats.minTicks;
+        stats.maxTicks = ticks > stats.maxTicks ? ticks : stats.maxTicks;
+        const size_t bucket = ticks < 2 ? 0 : static_cast<size_t>(31 - __builtin_clz(ticks));
+        stats.histogram[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1]++;
+        return true;
+    }
+
+    /**
+     * @param probe the probe index
+     * @return the probe's statistics; empty statistics if the probe doesn't exist
+     */
+    [[nodiscard]] const Stats& getStats(const size_t probe) const
+    {
+        static const Stats empty;
+        return probe < PROBES ? m_Stats[probe] : empty;
+    }
+
+    /** <b>Forget every recorded run of every probe.</b> */
+    void reset()
+    {
+        for (Stats& stats : m_Stats)
+        {
+            stats = Stats();
+        }
+    }
+
+    /** @return the number of probes */
+    [[nodiscard]] static constexpr size_t getProbeCount()
+    {
+        return PROBES;
+    }
+
+private:
+    /** Statistics per probe. */
+    Stats m_Stats[PROBES];
+};
+
+/**
+ * <b>Times its own lifetime into a ProbeTable.</b>
+ *
+ * Use it through PROBE_SCOPE() so it compiles out when probes are disabled.
+ */
+template <typename TABLE> class ProbeScope
+{
+public:
+    /**
+     * @param table the table the run is recorded into
+     * @param probe the probe index
+     */
+    ProbeScope(TABLE& table, const size_t probe) : m_Table(table), m_Probe(probe), m_Start(probeTicks())
+    {
+    }
+
+    ~ProbeScope()
+    {
+        m_Table.record(m_Probe, probeTicks() - m_Start);
+    }
+
+    // Delete copy and move constructors/operators
+
+    ProbeScope(const ProbeScope&) = delete;
+    ProbeScope& operator=(const ProbeScope&) = delete;
+    ProbeScope(ProbeScope&&) = delete;
+    ProbeScope& operator=(ProbeScope&&) = delete;
+
+private:
+    /** Table the run is recorded into. */
+    TABLE& m_Table;
+    /** Probe index. */
+    size_t m_Probe;
+    /** Probe clock when the scope was entered. */
+    uint32_t m_Start;
+};
+
+#define PROBE_CONCAT_INNER(a, b) a##b
+#define PROBE_CONCAT(a, b) PROBE_CONCAT_INNER(a, b)
+
+#if PROBES_ENABLED
+/** Time the rest of the enclosing scope as one run of probe in table. */
+#define PROBE_SCOPE(table, probe) ProbeScope<decltype(table)> PROBE_CONCAT(probeScope, __LINE__)((table), (probe))
+/** Record ticks as one run of probe in table, for sections that don't fit a scope. */
+#define PROBE_RECORD(table, probe, ticks) (table).record((probe), (ticks))
+#else
+#define PROBE_SCOPE(table, probe) static_cast<void>(0)
+#define PROBE_RECORD(table, probe, ticks) static_cast<void>(0)
+#endif
+
+#endif //PROBE_H
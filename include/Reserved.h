@@ -2,31 +2,9 @@
 #define RESERVED_H
 
 #include <cstdint>
+#include <cstddef>
 
-/** CAN Message IDs that are reserved */
-enum ReservedIDs : uint32_t
-{
-    // Custom Sensor Messages
-
-    StartSwitchId, Throttle1PositionId, Throttle2PositionId, BrakePressureId, RVCId, TireRPMId, TireTemperatureId, BMSPercentageId,
-    BMSTemperatureId, SteeringWheelAngleId,
-    // Motor Messages
-
-    Temperatures1Id=0x0A0, Temperatures2Id, Temperatures3Id, AnalogInputVoltagesId, DigitalInputStatusId, MotorPositionInfoId,
-    CurrentInfoId, VoltageInfoId, FluxInfoId, InternalVoltagesId, InternalStatesId, FaultCodesId, TorqueAndTimerInfoId,
-    ModulationIndexId, FirmwareInformationId, DiagnosticDataId, HighSpeedId, TorqueCapabilityId,
-    // Motor Commands/Response Messages
-
-    ControlCommandId=0x0C0, ParameterCommandId, ParameterResponseId,
-    // Health Check Commands/Response Messages
-
-    HealthCheckId=200, DCFId, DCRId, DCTId,
-    // Other Commands/Response Messages
-    FaultId, DriveStateId, DriveModeId, ThrottleMinId, ThrottleMaxId,
-
-    // ID for default initializations.
-    INVALIDId=0xFFFFFFFF,
-};
+#include "ReservedIds.h"
 
 enum FaultSourcesIDs : uint8_t
 {
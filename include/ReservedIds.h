@@ -0,0 +1,158 @@
+// Generated by tools/dbcgen.py from dbc/reserved.dbc - do not edit, edit the DBC file and regenerate.
+
+#ifndef RESERVEDIDS_H
+#define RESERVEDIDS_H
+
+#include <cstdint>
+#include <cstddef>
+
+/** CAN Message IDs that are reserved */
+enum ReservedIDs : uint32_t
+{
+    // Custom Sensor Messages
+
+    StartSwitchId, Throttle1PositionId, Throttle2PositionId, BrakePressureId, RVCId, TireRPMId, TireTemperatureId,
+    BMSPercentageId, BMSTemperatureId, SteeringWheelAngleId, PedalBoxId,
+    // Motor Messages
+
+    Temperatures1Id=0x0A0, Temperatures2Id, Temperatures3Id, AnalogInputVoltagesId, DigitalInputStatusId,
+    MotorPositionInfoId, CurrentInfoId, VoltageInfoId, FluxInfoId, InternalVoltagesId, InternalStatesId, FaultCodesId,
+    TorqueAndTimerInfoId, ModulationIndexId, FirmwareInformationId, DiagnosticDataId, HighSpeedId, TorqueCapabilityId,
+    // Motor Commands/Response Messages
+
+    ControlCommandId=0x0C0, ParameterCommandId, ParameterResponseId,
+    // Health Check Commands/Response Messages
+
+    HealthCheckId=0x0C8, DCFId, DCRId, DCTId,
+    // Other Commands/Response Messages
+
+    FaultId, DriveStateId, DriveModeId, ThrottleMinId, ThrottleMaxId, SignalStatsId,
+
+    // ID for default initializations.
+    INVALIDId=0xFFFFFFFF,
+};
+
+/** Number of ReservedIDs, excluding INVALIDId. */
+constexpr size_t RESERVED_ID_COUNT = 42;
+
+/**
+ * <b>Map a ReservedIDs value onto a dense index, for per-ID lookup tables.</b>
+ *
+ * @param id any arbitration ID
+ * @return An index in [0, RESERVED_ID_COUNT) for reserved IDs; RESERVED_ID_COUNT for anything else
+ */
+constexpr size_t reservedIdIndex(const uint32_t id)
+{
+    if (id <= PedalBoxId)
+    {
+        return id;
+    }
+    if (id >= Temperatures1Id && id <= TorqueCapabilityId)
+    {
+        return 11 + (id - Temperatures1Id);
+    }
+    if (id >= ControlCommandId && id <= ParameterResponseId)
+    {
+        return 29 + (id - ControlCommandId);
+    }
+    if (id >= HealthCheckId && id <= SignalStatsId)
+    {
+        return 32 + (id - HealthCheckId);
+    }
+    return RESERVED_ID_COUNT;
+}
+
+/**
+ * <b>Map a dense index back onto its ReservedIDs value.</b>
+ *
+ * @param index an index returned by reservedIdIndex()
+ * @return The reserved ID at index; INVALIDId if index is out of range
+ */
+constexpr ReservedIDs reservedIdAt(const size_t index)
+{
+    if (index < 11)
+    {
+        return static_cast<ReservedIDs>(index);
+    }
+    if (index < 29)
+    {
+        return static_cast<ReservedIDs>(Temperatures1Id + (index - 11));
+    }
+    if (index < 32)
+    {
+        return static_cast<ReservedIDs>(ControlCommandId + (index - 29));
+    }
+    if (index < RESERVED_ID_COUNT)
+    {
+        return static_cast<ReservedIDs>(HealthCheckId + (index - 32));
+    }
+    return INVALIDId;
+}
+
+/** Static description of a reserved ID, from the DBC file. */
+struct ReservedIdInfo
+{
+    ReservedIDs id;
+    /** Message name without the Id suffix. */
+    const char* name;
+    /** Payload length in bytes. */
+    uint8_t dlc;
+    /** Number of signals MessageCodecs.h decodes; 0 for raw or multiplexed payloads. */
+    uint8_t signalCount;
+    /** Transmission period in milliseconds; 0 for event-driven messages. */
+    uint16_t periodMs;
+};
+
+/** Description of every reserved ID, indexed by reservedIdIndex(). */
+inline constexpr ReservedIdInfo RESERVED_ID_INFO[RESERVED_ID_COUNT] = {
+    {StartSwitchId, "StartSwitch", 1, 1, 0},
+    {Throttle1PositionId, "Throttle1Position", 2, 1, 1},
+    {Throttle2PositionId, "Throttle2Position", 2, 1, 1},
+    {BrakePressureId, "BrakePressure", 2, 1, 1},
+    {RVCId, "RVC", 8, 0, 10},
+    {TireRPMId, "TireRPM", 8, 0, 10},
+    {TireTemperatureId, "TireTemperature", 8, 0, 100},
+    {BMSPercentageId, "BMSPercentage", 1, 1, 1000},
+    {BMSTemperatureId, "BMSTemperature", 2, 1, 1000},
+    {SteeringWheelAngleId, "SteeringWheelAngle", 2, 1, 10},
+    {PedalBoxId, "PedalBox", 8, 5, 1},
+    {Temperatures1Id, "Temperatures1", 8, 4, 100},
+    {Temperatures2Id, "Temperatures2", 8, 4, 100},
+    {Temperatures3Id, "Temperatures3", 8, 4, 100},
+    {AnalogInputVoltagesId, "AnalogInputVoltages", 8, 6, 0},
+    {DigitalInputStatusId, "DigitalInputStatus", 8, 8, 0},
+    {MotorPositionInfoId, "MotorPositionInfo", 8, 4, 3},
+    {CurrentInfoId, "CurrentInfo", 8, 4, 3},
+    {VoltageInfoId, "VoltageInfo", 8, 4, 3},
+    {FluxInfoId, "FluxInfo", 8, 4, 0},
+    {InternalVoltagesId, "InternalVoltages", 8, 4, 0},
+    {InternalStatesId, "InternalStates", 8, 11, 100},
+    {FaultCodesId, "FaultCodes", 8, 4, 100},
+    {TorqueAndTimerInfoId, "TorqueAndTimerInfo", 8, 3, 3},
+    {ModulationIndexId, "ModulationIndex", 8, 4, 0},
+    {FirmwareInformationId, "FirmwareInformation", 8, 4, 0},
+    {DiagnosticDataId, "DiagnosticData", 8, 0, 0},
+    {HighSpeedId, "HighSpeed", 8, 4, 3},
+    {TorqueCapabilityId, "TorqueCapability", 2, 1, 0},
+    {ControlCommandId, "ControlCommand", 8, 7, 3},
+    {ParameterCommandId, "ParameterCommand", 8, 3, 0},
+    {ParameterResponseId, "ParameterResponse", 8, 3, 0},
+    {HealthCheckId, "HealthCheck", 6, 2, 0},
+    {DCFId, "DCF", 6, 2, 0},
+    {DCRId, "DCR", 6, 2, 0},
+    {DCTId, "DCT", 6, 2, 0},
+    {FaultId, "Fault", 3, 3, 100},
+    {DriveStateId, "DriveState", 1, 1, 100},
+    {DriveModeId, "DriveMode", 1, 1, 0},
+    {ThrottleMinId, "ThrottleMin", 2, 1, 0},
+    {ThrottleMaxId, "ThrottleMax", 2, 1, 0},
+    {SignalStatsId, "SignalStats", 8, 0, 0},
+};
+
+/** @return the description of id; nullptr if id isn't reserved */
+constexpr const ReservedIdInfo* reservedIdInfo(const uint32_t id)
+{
+    return reservedIdIndex(id) < RESERVED_ID_COUNT ? &RESERVED_ID_INFO[reservedIdIndex(id)] : nullptr;
+}
+
+#endif //RESERVEDIDS_H
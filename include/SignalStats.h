@@ -0,0 +1,492 @@
+#ifndef SIGNALSTATS_H
+#define SIGNALSTATS_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/**
+ * <b>Cumulative min, max, mean and variance using Welford's algorithm.</b>
+ *
+ * Every add() is O(1) and numerically stable, with no stored samples and no sum of squares to overflow or cancel.
+ */
+class WelfordStats
+{
+public:
+    /** <b>Add a sample.</b> */
+    void add(const double x)
+    {
+        m_Count++;
+        const double delta = x - m_Mean;
+        m_Mean += delta / m_Count;
+        m_M2 += delta * (x - m_Mean);
+        m_Min = x < m_Min ? x : m_Min;
+        m_Max = x > m_Max ? x : m_Max;
+    }
+
+    /**
+     * <b>Remove a sample that was previously added.</b>
+     *
+     * Keeps mean and variance exact for sliding windows; min and max are not updated.
+     */
+    void remove(const double x)
+    {
+        if (m_Count <= 1)
+        {
+            m_Count = 0;
+            m_Mean = 0;
+            m_M2 = 0;
+            return;
+        }
+        m_Count--;
+        const double delta = x - m_Mean;
+        m_Mean -= delta / m_Count;
+        m_M2 -= delta * (x - m_Mean);
+        m_M2 = m_M2 > 0 ? m_M2 : 0;
+    }
+
+    /** <b>Forget every sample.</b> */
+    void reset()
+    {
+        *this = WelfordStats();
+    }
+
+    /** @return the number of samples */
+    [[nodiscard]] uint32_t getCount() const
+    {
+        return m_Count;
+    }
+
+    /** @return the mean; 0 without samples */
+    [[nodiscard]] double getMean() const
+    {
+        return m_Mean;
+    }
+
+    /** @return the population variance; 0 without samples */
+    [[nodiscard]] double getVariance() const
+    {
+        return m_Count > 0 ? m_M2 / m_Count : 0;
+    }
+
+    /** @return the population standard deviation; 0 without samples */
+    [[nodiscard]] double getStdDev() const
+    {
+        return sqrt(getVariance());
+    }
+
+    /** @return the smallest sample; +infinity without samples */
+    [[nodiscard]] double getMin() const
+    {
+        return m_Min;
+    }
+
+    /** @return the largest sample; -infinity without samples */
+    [[nodiscard]] double getMax() const
+    {
+        return m_Max;
+    }
+
+private:
+    uint32_t m_Count = 0;
+    double m_Mean = 0;
+    /** Sum of squared differences from the current mean. */
+    double m_M2 = 0;
+    double m_Min = INFINITY;
+    double m_Max = -INFINITY;
+};
+
+/**
+ * <b>Min, max, mean and variance of the last WINDOW samples.</b>
+ *
+ * Mean and variance slide with Welford add/remove updates. Min and max use monotonic queues of sample positions, so
+ * each sample is pushed and popped at most once and every add() is amortized O(1).
+ *
+ * @tparam WINDOW the number of samples in the window; must be a power of two
+ */
+template <size_t WINDOW = 64> class WindowStats
+{
+    static_assert(WINDOW > 0 && (WINDOW & (WINDOW - 1)) == 0, "WindowStats WINDOW must be a power of two");
+
+public:
+    /** <b>Add a sample, dropping the oldest one if the window is full.</b> */
+    void add(const float x)
+    {
+        if (m_Next >= WINDOW)
+        {
+            m_Stats.remove(m_Samples[m_Next & MASK]);
+        }
+        m_Samples[m_Next & MASK] = x;
+        m_Stats.add(x);
+
+        // Expire positions that left the window, then drop queued samples the new one dominates
+        const uint32_t oldest = m_Next >= WINDOW ? m_Next - WINDOW + 1 : 0;
+        m_MinQueue.expire(oldest);
+        m_MaxQueue.expire(oldest);
+        while (!m_MinQueue.empty() && m_Samples[m_MinQueue.back() & MASK] >= x)
+        {
+            m_MinQueue.popBack();
+        }
+        while (!m_MaxQueue.empty() && m_Samples[m_MaxQueue.back() & MASK] <= x)
+        {
+            m_MaxQueue.popBack();
+        }
+        m_MinQueue.pushBack(m_Next);
+        m_MaxQueue.pushBack(m_Next);
+        m_Next++;
+    }
+
+    /** <b>Forget every sample.</b> */
+    void reset()
+    {
+        *this = WindowStats();
+    }
+
+    /** @return the number of samples in the window */
+    [[nodiscard]] uint32_t getCount() const
+    {
+        return m_Stats.getCount();
+    }
+
+    /** @return the mean of the window; 0 without samples */
+    [[nodiscard]] double getMean() const
+    {
+        return m_Stats.getMean();
+    }
+
+    /** @return the population variance of the window; 0 without samples */
+    [[nodiscard]] double getVariance() const
+    {
+        return m_Stats.getVariance();
+    }
+
+    /** @return the population standard deviation of the window; 0 without samples */
+    [[nodiscard]] double getStdDev() const
+    {
+        return m_Stats.getStdDev();
+    }
+
+    /** @return the smallest sample in the window; +infinity without samples */
+    [[nodiscard]] double getMin() const
+    {
+        return m_MinQueue.empty() ? INFINITY : m_Samples[m_MinQueue.front() & MASK];
+    }
+
+    /** @return the largest sample in the window; -infinity without samples */
+    [[nodiscard]] double getMax() const
+    {
+        return m_MaxQueue.empty() ? -INFINITY : m_Samples[m_MaxQueue.front() & MASK];
+    }
+
+private:
+    /** Mask that turns a sample position into a ring index. */
+    static constexpr uint32_t MASK = static_cast<uint32_t>(WINDOW - 1);
+
+    /** Double-ended queue of sample positions, at most WINDOW long. */
+    struct PositionQueue
+    {
+        uint32_t positions[WINDOW] = {};
+        uint32_t head = 0;
+        uint32_t tail = 0;
+
+        bool empty() const { return head == tail; }
+        uint32_t front() const { return positions[head & MASK]; }
+        uint32_t back() const { return positions[(tail - 1) & MASK]; }
+        void pushBack(const uint32_t position) { positions[tail++ & MASK] = position; }
+        void popBack() { tail--; }
+
+        void expire(const uint32_t oldest)
+        {
+            while (!empty() && front() < oldest)
+            {
+                head++;
+            }
+        }
+    };
+
+    /** The last WINDOW samples, indexed by position. */
+    float m_Samples[WINDOW] = {};
+    /** Position of the next sample. */
+    uint32_t m_Next = 0;
+    /** Mean and variance of the window. */
+    WelfordStats m_Stats;
+    /** Positions of increasing samples; the front is the window minimum. */
+    PositionQueue m_MinQueue;
+    /** Positions of decreasing samples; the front is the window maximum. */
+    PositionQueue m_MaxQueue;
+};
+
+/** A SignalStatsId snapshot, reassembled from its two pages. */
+struct SignalStatsSnapshot
+{
+    /** Signal the snapshot describes. */
+    ReservedIDs id = INVALIDId;
+    /** True for sliding-window statistics, false for cumulative ones. */
+    bool window = false;
+    /** Bit n is set once page n has been received. */
+    uint8_t pages = 0;
+    /** Statistics in the sender's scaled units: value * scale, rounded and saturated. */
+    int16_t min = 0;
+    int16_t max = 0;
+    int16_t mean = 0;
+    uint16_t stdDev = 0;
+    /** Number of samples, saturated at UINT32_MAX. */
+    uint32_t count = 0;
+
+    /** @return true once both pages have been received */
+    [[nodiscard]] bool complete() const
+    {
+        return pages == 0x03;
+    }
+};
+
+/**
+ * <b>Per-signal cumulative and sliding-window statistics, configured per ReservedIDs.</b>
+ *
+ * add() is called with every decoded value and updates both the session-long WelfordStats and the WindowStats of the
+ * signal in O(1). Finding a signal's statistics is a dense reservedIdIndex() lookup.
+ *
+ * Snapshots are sent as two SignalStatsId frames. The first payload byte selects the signal and page: bits 0-5 hold
+ * the signal's reservedIdIndex(), bit 6 the page and bit 7 is set for window statistics.
+ * - page 0: int16_t min, int16_t max, int16_t mean
+ * - page 1: uint16_t standard deviation, uint32_t sample count
+ *
+ * Values are sent as value * scale, so a scale of 10 sends temperatures in tenths of a degree.
+ *
+ * <code>
+ * SignalStats<> stats;
+ * stats.configure(BMSTemperatureId, 10);
+ * stats.add(BMSTemperatureId, temperature);
+ * CanFrame frames[2];
+ * stats.packSnapshot(BMSTemperatureId, true, frames);
+ * </code>
+ * @tparam MAX_SIGNALS the maximum number of configured IDs
+ * @tparam WINDOW the number of samples in every sliding window; must be a power of two
+ */
+template <size_t MAX_SIGNALS = 8, size_t WINDOW = 64> class SignalStats
+{
+    static_assert(MAX_SIGNALS > 0 && MAX_SIGNALS < 0xFF, "SignalStats supports 1 to 254 signals");
+    static_assert(RESERVED_ID_COUNT <= 0x40, "SignalStatsId selectors hold a 6-bit reserved ID index");
+
+public:
+    SignalStats()
+    {
+        memset(m_Slots, NO_SLOT, sizeof(m_Slots));
+    }
+
+    /**
+     * <b>Start keeping statistics of an ID, or change its snapshot scale.</b>
+     *
+     * @param id the reserved ID carrying the signal
+     * @param scale the factor values are multiplied by before packing into a snapshot
+     * @return false if id isn't a reserved ID or MAX_SIGNALS IDs are already configured, true otherwise
+     */
+    bool configure(const uint32_t id, const float scale = 1)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index >= RESERVED_ID_COUNT)
+        {
+            return false;
+        }
+        if (m_Slots[index] == NO_SLOT)
+        {
+            if (m_SignalCount >= MAX_SIGNALS)
+            {
+                return false;
+            }
+            m_Slots[index] = static_cast<uint8_t>(m_SignalCount++);
+        }
+        m_Signals[m_Slots[index]].scale = scale;
+        return true;
+    }
+
+    /**
+     * <b>Add a decoded value of an ID's signal.</b>
+     *
+     * @return false if id isn't configured, true otherwise
+     */
+    bool add(const uint32_t id, const float value)
+    {
+        Signal* signal = find(id);
+        if (signal == nullptr)
+        {
+            return false;
+        }
+        signal->cumulative.add(value);
+        signal->window.add(value);
+        return true;
+    }
+
+    /** @return the session-long statistics of id; nullptr if id isn't configured */
+    [[nodiscard]] const WelfordStats* getCumulative(const uint32_t id) const
+    {
+        const Signal* signal = find(id);
+        return signal != nullptr ? &signal->cumulative : nullptr;
+    }
+
+    /** @return the sliding-window statistics of id; nullptr if id isn't configured */
+    [[nodiscard]] const WindowStats<WINDOW>* getWindow(const uint32_t id) const
+    {
+        const Signal* signal = find(id);
+        return signal != nullptr ? &signal->window : nullptr;
+    }
+
+    /** <b>Restart the session-long statistics of every signal.</b> */
+    void resetCumulative()
+    {
+        for (size_t i = 0; i < m_SignalCount; i++)
+        {
+            m_Signals[i].cumulative.reset();
+        }
+    }
+
+    /**
+     * <b>Pack a two-frame SignalStatsId snapshot of a signal.</b>
+     *
+     * @param id the signal to snapshot
+     * @param window true for the sliding-window statistics, false for the cumulative ones
+     * @param frames receives page 0 and page 1
+     * @return false if id isn't configured or has no samples, true otherwise
+     */
+    bool packSnapshot(const uint32_t id, const bool window, CanFrame (&frames)[2]) const
+    {
+        const Signal* signal = find(id);
+        if (signal == nullptr || signal->cumulative.getCount() == 0)
+        {
+            return false;
+        }
+        const float scale = signal->scale;
+        const uint8_t selector = static_cast<uint8_t>(reservedIdIndex(id) | (window ? WINDOW_FLAG : 0));
+        const double min = window ? signal->window.getMin() : signal->cumulative.getMin();
+        const double max = window ? signal->window.getMax() : signal->cumulative.getMax();
+        const double mean = window ? signal->window.getMean() : signal->cumulative.getMean();
+        const double stdDev = window ? signal->window.getStdDev() : signal->cumulative.getStdDev();
+        const uint32_t count = window ? signal->window.getCount() : signal->cumulative.getCount();
+
+        BufferPacker<CAN_MAX_DLC> page0;
+        page0.reset();
+        page0.pack(selector);
+        page0.pack(saturate<int16_t>(min * scale));
+        page0.pack(saturate<int16_t>(max * scale));
+        page0.pack(saturate<int16_t>(mean * scale));
+
+        BufferPacker<CAN_MAX_DLC> page1;
+        page1.reset();
+        page1.pack(static_cast<uint8_t>(selector | PAGE_FLAG));
+        page1.pack(saturate<uint16_t>(stdDev * scale));
+        page1.pack(count);
+
+        frames[0] = CanFrame{};
+        frames[1] = CanFrame{};
+        return frames[0].pack(SignalStatsId, page0) && frames[1].pack(SignalStatsId, page1);
+    }
+
+    /**
+     * <b>Merge one SignalStatsId page into a snapshot.</b>
+     *
+     * A page for a different signal or mode than the snapshot holds starts a new snapshot.
+     *
+     * @param frame the received frame
+     * @param snapshot the snapshot to merge the page into
+     * @return false if the frame isn't a valid SignalStatsId page, true otherwise
+     */
+    static bool unpackSnapshot(const CanFrame& frame, SignalStatsSnapshot& snapshot)
+    {
+        if (frame.id != SignalStatsId)
+        {
+            return false;
+        }
+        auto unpacker = frame.unpacker();
+        const auto selector = unpacker.unpack<uint8_t>();
+        const ReservedIDs id = reservedIdAt(selector & INDEX_MASK);
+        const bool window = (selector & WINDOW_FLAG) != 0;
+        if (!unpacker || id == INVALIDId)
+        {
+            return false;
+        }
+        SignalStatsSnapshot merged = snapshot.id == id && snapshot.window == window ? snapshot : SignalStatsSnapshot{};
+        merged.id = id;
+        merged.window = window;
+        if (selector & PAGE_FLAG)
+        {
+            merged.stdDev = unpacker.unpack<uint16_t>();
+            merged.count = unpacker.unpack<uint32_t>();
+            merged.pages |= 0x02;
+        }
+        else
+        {
+            merged.min = unpacker.unpack<int16_t>();
+            merged.max = unpacker.unpack<int16_t>();
+            merged.mean = unpacker.unpack<int16_t>();
+            merged.pages |= 0x01;
+        }
+        if (!unpacker)
+        {
+            return false;
+        }
+        snapshot = merged;
+        return true;
+    }
+
+private:
+    /** Slot value of an unconfigured ID. */
+    static constexpr uint8_t NO_SLOT = 0xFF;
+    /** Selector bits holding the reserved ID index. */
+    static constexpr uint8_t INDEX_MASK = 0x3F;
+    /** Selector bit set on page 1. */
+    static constexpr uint8_t PAGE_FLAG = 0x40;
+    /** Selector bit set for window statistics. */
+    static constexpr uint8_t WINDOW_FLAG = 0x80;
+
+    /** Statistics of one configured ID. */
+    struct Signal
+    {
+        float scale = 1;
+        WelfordStats cumulative;
+        WindowStats<WINDOW> window;
+    };
+
+    /** @return value rounded and clamped to the range of T */
+    template <typename T> static T saturate(const double value)
+    {
+        const double rounded = round(value);
+        if (!(rounded > static_cast<double>(std::numeric_limits<T>::min())))
+        {
+            return std::numeric_limits<T>::min();
+        }
+        if (rounded >= static_cast<double>(std::numeric_limits<T>::max()))
+        {
+            return std::numeric_limits<T>::max();
+        }
+        return static_cast<T>(rounded);
+    }
+
+    Signal* find(const uint32_t id)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index >= RESERVED_ID_COUNT || m_Slots[index] == NO_SLOT)
+        {
+            return nullptr;
+        }
+        return &m_Signals[m_Slots[index]];
+    }
+
+    const Signal* find(const uint32_t id) const
+    {
+        return const_cast<SignalStats*>(this)->find(id);
+    }
+
+    /** Index into m_Signals for every reservedIdIndex(); NO_SLOT if unconfigured. */
+    uint8_t m_Slots[RESERVED_ID_COUNT];
+    /** Configured signals, in configuration order. */
+    Signal m_Signals[MAX_SIGNALS];
+    /** Number of configured signals. */
+    size_t m_SignalCount = 0;
+};
+
+#endif //SIGNALSTATS_H
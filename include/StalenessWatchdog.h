@@ -0,0 +1,328 @@
+#ifndef STALENESSWATCHDOG_H
+#define STALENESSWATCHDOG_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "Reserved.h"
+
+/** Freshness counters kept for every ID a StalenessWatchdog watches. */
+struct StalenessStats
+{
+    /** Time between the two most recent receipts, in microseconds. */
+    uint32_t lastGapUs = 0;
+    /** Longest time between two receipts, in microseconds, including any time spent stale. */
+    uint32_t maxGapUs = 0;
+    /** Times the ID went stale. */
+    uint32_t expiries = 0;
+};
+
+/**
+ * <b>Per-ID message freshness watchdog on a hashed timing wheel.</b>
+ *
+ * Every watched ID has a timer that feed() re-arms on each receipt. If a timer runs out before the next receipt,
+ * poll() reports the ID through the expiry callback once and the ID stays stale until it is fed again.
+ *
+ * Timers hang in doubly linked lists, one per wheel slot, picked by deadline tick modulo SLOTS. Re-arming unlinks
+ * the timer and links it into its new slot, so feed() costs O(1) no matter how many IDs are watched. poll() only
+ * visits the slots of the ticks that passed since the last poll; timeouts longer than the wheel just stay in their
+ * slot for more than one revolution.
+ *
+ * Time is counted in ticks from the first watch() or poll(), so the 32-bit micros() wrap doesn't disturb the slot
+ * hashing.
+ *
+ * <code>
+ * StalenessWatchdog<> watchdog(onStale, nullptr);
+ * watchdog.watch(Throttle1PositionId, 10000, micros());
+ * watchdog.watch(BrakePressureId, 10000, micros());
+ * ...
+ * watchdog.feed(rxFrame.id, micros());
+ * watchdog.poll(micros());
+ * </code>
+ * @tparam SLOTS the number of wheel slots, a power of two
+ * @tparam TICK_US the wheel resolution in microseconds; expiries are reported up to one tick late
+ */
+template <size_t SLOTS = 64, uint32_t TICK_US = 1000> class StalenessWatchdog
+{
+    static_assert(SLOTS > 0 && (SLOTS & (SLOTS - 1)) == 0, "StalenessWatchdog SLOTS must be a power of two");
+    static_assert(TICK_US > 0, "StalenessWatchdog needs a tick of at least one microsecond");
+    static_assert(RESERVED_ID_COUNT < 0xFF, "StalenessWatchdog links timers with 8-bit indices");
+
+public:
+    /** Called from poll() when an ID goes stale; silentUs is the time since it was last received or watched. */
+    using ExpiryCallback = void (*)(uint32_t id, uint32_t silentUs, void* context);
+
+    /**
+     * @param onExpiry the callback invoked when an ID goes stale
+     * @param context opaque pointer handed back to onExpiry
+     */
+    StalenessWatchdog(const ExpiryCallback onExpiry, void* context) : m_OnExpiry(onExpiry), m_Context(context)
+    {
+        for (uint8_t& head : m_Heads)
+        {
+            head = NONE;
+        }
+    }
+
+    // Delete copy and move constructors/operators
+
+    StalenessWatchdog(const StalenessWatchdog&) = delete;
+    StalenessWatchdog& operator=(const StalenessWatchdog&) = delete;
+    StalenessWatchdog(StalenessWatchdog&&) = delete;
+    StalenessWatchdog& operator=(StalenessWatchdog&&) = delete;
+
+    /**
+     * <b>Start watching an ID and arm its first timeout.</b>
+     *
+     * Watching an ID again changes its timeout, re-arms it and clears its counters.
+     *
+     * @param id the reserved ID to watch
+     * @param timeoutUs the longest acceptable time between receipts, in microseconds
+     * @param nowUs the current time in microseconds
+     * @return false if the ID isn't reserved or the timeout is 0, true otherwise
+     */
+    bool watch(const ReservedIDs id, const uint32_t timeoutUs, const uint32_t nowUs)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index == RESERVED_ID_COUNT || timeoutUs == 0)
+        {
+            return false;
+        }
+        start(nowUs);
+        Timer& timer = m_Timers[index];
+        unlink(index);
+        timer = {};
+        timer.timeoutTicks = (timeoutUs + TICK_US - 1) / TICK_US;
+        timer.watched = true;
+        arm(index, nowUs);
+        return true;
+    }
+
+    /**
+     * <b>Stop watching an ID.</b>
+     *
+     * @param id the reserved ID
+     * @return false if the ID wasn't watched, true otherwise
+     */
+    bool unwatch(const uint32_t id)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index == RESERVED_ID_COUNT || !m_Timers[index].watched)
+        {
+            return false;
+        }
+        unlink(index);
+        m_Timers[index].watched = false;
+        return true;
+    }
+
+    /**
+     * <b>Record the receipt of a frame and re-arm its ID's timer.</b>
+     *
+     * @param id the arbitration ID of the received frame
+     * @param nowUs the receive time in microseconds
+     * @return false if the ID isn't watched, true otherwise
+     */
+    bool feed(const uint32_t id, const uint32_t nowUs)
+    {
+        const size_t index = reservedIdIndex(id);
+        if (index == RESERVED_ID_COUNT || !m_Timers[index].watched)
+        {
+            return false;
+        }
+        Timer& timer = m_Timers[index];
+        const uint32_t gap = nowUs - timer.lastSeenUs;
+        if (timer.received)
+        {
+            timer.stats.lastGapUs = gap;
+            timer.stats.maxGapUs = gap > timer.stats.maxGapUs ? gap : timer.stats.maxGapUs;
+        }
+        timer.received = true;
+        timer.stale = false;
+        unlink(index);
+        arm(index, nowUs);
+        return true;
+    }
+
+    /**
+     * <b>Advance the wheel to the current time and report every ID that went stale.</b>
+     *
+     * @param nowUs the current time in microseconds
+     * @return The number of IDs that went stale during this call
+     */
+    size_t poll(const uint32_t nowUs)
+    {
+        start(nowUs);
+        const uint32_t target = tickAt(nowUs);
+        const uint32_t elapsedUs = static_cast<int32_t>(nowUs - m_LastUs) > 0 ? nowUs - m_LastUs : 0;
+        m_CarryUs = (m_CarryUs + elapsedUs) % TICK_US;
+        m_LastUs = nowUs;
+
+        const uint32_t ticks = target - m_Tick;
+        const uint32_t steps = ticks < SLOTS ? ticks : SLOTS;
+        size_t expired = 0;
+        for (uint32_t step = 1; step <= steps; step++)
+        {
+            expired += expire((m_Tick + step) & (SLOTS - 1), target, nowUs);
+        }
+        m_Tick = target;
+        return expired;
+    }
+
+    /**
+     * @param id the reserved ID
+     * @return true if the ID is watched and went stale since it was last received
+     */
+    [[nodiscard]] bool isStale(const uint32_t id) const
+    {
+        const size_t index = reservedIdIndex(id);
+        return index != RESERVED_ID_COUNT && m_Timers[index].watched && m_Timers[index].stale;
+    }
+
+    /**
+     * @param id the reserved ID
+     * @return the ID's freshness counters; nullptr if it isn't watched
+     */
+    [[nodiscard]] const StalenessStats* getStats(const uint32_t id) const
+    {
+        const size_t index = reservedIdIndex(id);
+        return index != RESERVED_ID_COUNT && m_Timers[index].watched ? &m_Timers[index].stats : nullptr;
+    }
+
+    /** <b>Zero the freshness counters of every watched ID.</b> */
+    void resetStats()
+    {
+        for (Timer& timer : m_Timers)
+        {
+            timer.stats = {};
+        }
+    }
+
+private:
+    /** Marks the end of a slot list. */
+    static constexpr uint8_t NONE = 0xFF;
+
+    /** The timer of one ID, indexed by reservedIdIndex(). */
+    struct Timer
+    {
+        /** Tick at which the timer runs out. */
+        uint32_t deadline = 0;
+        /** Timeout rounded up to whole ticks. */
+        uint32_t timeoutTicks = 0;
+        /** Time of the most recent receipt, or of watch() before the first one. */
+        uint32_t lastSeenUs = 0;
+        /** Freshness counters. */
+        StalenessStats stats;
+        /** Neighbours in the slot list. */
+        uint8_t next = NONE;
+        uint8_t prev = NONE;
+        /** True while the timer is linked into a slot. */
+        bool linked = false;
+        bool watched = false;
+        bool received = false;
+        bool stale = false;
+    };
+
+    /** Anchor the tick count at the first call that carries a time. */
+    void start(const uint32_t nowUs)
+    {
+        if (!m_Started)
+        {
+            m_LastUs = nowUs;
+            m_Started = true;
+        }
+    }
+
+    /** @return the wheel tick a time falls into, relative to the last poll() */
+    [[nodiscard]] uint32_t tickAt(const uint32_t nowUs) const
+    {
+        const uint32_t elapsedUs = static_cast<int32_t>(nowUs - m_LastUs) > 0 ? nowUs - m_LastUs : 0;
+        return m_Tick + (m_CarryUs + elapsedUs) / TICK_US;
+    }
+
+    /** Set a timer's deadline one timeout after nowUs and link it into that tick's slot. */
+    void arm(const size_t index, const uint32_t nowUs)
+    {
+        Timer& timer = m_Timers[index];
+        timer.lastSeenUs = nowUs;
+        // +1 because nowUs may be anywhere inside its tick
+        timer.deadline = tickAt(nowUs) + timer.timeoutTicks + 1;
+
+        uint8_t& head = m_Heads[timer.deadline & (SLOTS - 1)];
+        timer.prev = NONE;
+        timer.next = head;
+        if (head != NONE)
+        {
+            m_Timers[head].prev = static_cast<uint8_t>(index);
+        }
+        head = static_cast<uint8_t>(index);
+        timer.linked = true;
+    }
+
+    /** Remove a timer from its slot list, if it is in one. */
+    void unlink(const size_t index)
+    {
+        Timer& timer = m_Timers[index];
+        if (!timer.linked)
+        {
+            return;
+        }
+        if (timer.prev != NONE)
+        {
+            m_Timers[timer.prev].next = timer.next;
+        }
+        else
+        {
+            m_Heads[timer.deadline & (SLOTS - 1)] = timer.next;
+        }
+        if (timer.next != NONE)
+        {
+            m_Timers[timer.next].prev = timer.prev;
+        }
+        timer.linked = false;
+    }
+
+    /** Fire and unlink every timer in a slot whose deadline has passed. */
+    size_t expire(const size_t slot, const uint32_t tick, const uint32_t nowUs)
+    {
+        size_t expired = 0;
+        uint8_t index = m_Heads[slot];
+        while (index != NONE)
+        {
+            Timer& timer = m_Timers[index];
+            const uint8_t next = timer.next;
+            if (static_cast<int32_t>(tick - timer.deadline) >= 0)
+            {
+                unlink(index);
+                timer.stale = true;
+                timer.stats.expiries++;
+                expired++;
+                if (m_OnExpiry != nullptr)
+                {
+                    m_OnExpiry(reservedIdAt(index), nowUs - timer.lastSeenUs, m_Context);
+                }
+            }
+            index = next;
+        }
+        return expired;
+    }
+
+    /** One timer per reserved ID. */
+    Timer m_Timers[RESERVED_ID_COUNT] = {};
+    /** First timer in each wheel slot. */
+    uint8_t m_Heads[SLOTS] = {};
+    /** Callback invoked when an ID goes stale. */
+    ExpiryCallback m_OnExpiry;
+    /** Opaque pointer handed back to m_OnExpiry. */
+    void* m_Context;
+    /** Tick the wheel was last advanced to. */
+    uint32_t m_Tick = 0;
+    /** Time of the last poll(). */
+    uint32_t m_LastUs = 0;
+    /** Microseconds since the start of the current tick at the last poll(). */
+    uint32_t m_CarryUs = 0;
+    /** True once m_LastUs holds a real time. */
+    bool m_Started = false;
+};
+
+#endif //STALENESSWATCHDOG_H
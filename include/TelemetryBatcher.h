@@ -0,0 +1,343 @@
+#ifndef TELEMETRYBATCHER_H
+#define TELEMETRYBATCHER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "CanFrame.h"
+#include "Cobs.h"
+
+/*
+ * Telemetry batch layout (all fields little-endian), sent as one COBS packet per batch:
+ *
+ *   Header   8 bytes  uint16_t sequence, uint8_t frame count, uint8_t version, uint32_t first timestamp
+ *   Records  9 + len bytes each  uint32_t timestamp delta from the first timestamp, uint32_t ID (bit 31: extended),
+ *                                uint8_t len, uint8_t data[len]
+ *
+ * The sequence number increments by one per batch and wraps at 16 bits, so a receiver can count lost batches.
+ */
+
+/** Version of the layout described above. */
+constexpr uint8_t TELEMETRY_BATCH_VERSION = 1;
+/** Size of the batch header in bytes. */
+constexpr size_t TELEMETRY_BATCH_HEADER_SIZE = 8;
+/** Size of a record without its data bytes. */
+constexpr size_t TELEMETRY_RECORD_HEADER_SIZE = 9;
+/** ID bit that marks an extended frame in a record. */
+constexpr uint32_t TELEMETRY_EXTENDED_FLAG = 0x80000000u;
+
+/** Counters kept by a TelemetryBatcher. */
+struct TelemetryBatcherStats
+{
+    /** Batches written to the sink. */
+    uint32_t batches = 0;
+    /** Frames written to the sink. */
+    uint32_t frames = 0;
+    /** Encoded bytes written to the sink. */
+    uint64_t bytes = 0;
+    /** Batches flushed because the next frame didn't fit. */
+    uint32_t sizeFlushes = 0;
+    /** Batches flushed because the oldest frame reached the deadline. */
+    uint32_t deadlineFlushes = 0;
+    /** Sink writes that didn't take the whole batch. */
+    uint32_t writeErrors = 0;
+    /** Longest time a frame waited in the batch before being written, in microseconds. */
+    uint32_t maxWaitUs = 0;
+};
+
+/**
+ * <b>Batches frames into USB-packet-sized writes for a serial telemetry link.</b>
+ *
+ * Writing each frame separately costs a USB transaction per frame; packing many frames into one write fills each
+ * packet instead. Frames are appended to a RAM batch and the batch is COBS-encoded and written to the sink in one
+ * write() when the next frame no longer fits, or when the oldest frame has waited for the deadline, whichever comes
+ * first. Each batch carries a frame count and a sequence number, so the receiver can detect gaps.
+ *
+ * <code>
+ * TelemetryBatcher<usb_serial_class> telemetry(Serial, 2000);
+ * telemetry.append(frame, micros());    // for every frame
+ * telemetry.poll(micros());             // every loop
+ * </code>
+ * @tparam SINK any output with write(const uint8_t*, size_t), e.g. Serial
+ * @tparam BATCH_SIZE the encoded size of a full batch; 512 matches a USB high-speed bulk packet, 64 a full-speed one
+ */
+template <typename SINK, size_t BATCH_SIZE = 512> class TelemetryBatcher
+{
+public:
+    /** Largest unencoded batch that still fits in BATCH_SIZE after COBS encoding. */
+    static constexpr size_t PAYLOAD_SIZE = cobsMaxPayloadSize(BATCH_SIZE);
+
+    static_assert(PAYLOAD_SIZE >= TELEMETRY_BATCH_HEADER_SIZE + TELEMETRY_RECORD_HEADER_SIZE + CAN_MAX_DLC,
+                  "TelemetryBatcher BATCH_SIZE must hold at least one frame");
+
+    /**
+     * @param sink the output batches are written to
+     * @param deadlineUs the longest a frame may wait in a batch before the batch is written, in microseconds
+     */
+    TelemetryBatcher(SINK& sink, const uint32_t deadlineUs) : m_Sink(sink), m_DeadlineUs(deadlineUs)
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    TelemetryBatcher(const TelemetryBatcher&) = delete;
+    TelemetryBatcher& operator=(const TelemetryBatcher&) = delete;
+    TelemetryBatcher(TelemetryBatcher&&) = delete;
+    TelemetryBatcher& operator=(TelemetryBatcher&&) = delete;
+
+    /**
+     * <b>Add a frame to the current batch, writing the batch first if the frame doesn't fit.</b>
+     *
+     * @param frame the frame to send
+     * @param nowUs the current time in microseconds, used for the deadline
+     * @return false if the frame's length is invalid, true otherwise
+     */
+    bool append(const CanFrame& frame, const uint32_t nowUs)
+    {
+        if (frame.len > CAN_MAX_DLC)
+        {
+            return false;
+        }
+        const size_t recordSize = TELEMETRY_RECORD_HEADER_SIZE + frame.len;
+        if (m_Count == UINT8_MAX || m_Size + recordSize > PAYLOAD_SIZE)
+        {
+            m_Stats.sizeFlushes++;
+            flush(nowUs);
+        }
+        if (m_Count == 0)
+        {
+            m_OpenedUs = nowUs;
+            m_FirstTimestamp = frame.timestamp;
+            m_Size = TELEMETRY_BATCH_HEADER_SIZE;
+        }
+
+        const uint32_t delta = frame.timestamp - m_FirstTimestamp;
+        const uint32_t id = frame.extended ? frame.id | TELEMETRY_EXTENDED_FLAG : frame.id;
+        memcpy(&m_Payload[m_Size], &delta, sizeof(delta));
+        memcpy(&m_Payload[m_Size + 4], &id, sizeof(id));
+        m_Payload[m_Size + 8] = frame.len;
+        memcpy(&m_Payload[m_Size + TELEMETRY_RECORD_HEADER_SIZE], frame.buf, frame.len);
+        m_Size += recordSize;
+        m_Count++;
+        return true;
+    }
+
+    /**
+     * <b>Write the current batch if its oldest frame has waited for the deadline.</b>
+     *
+     * @param nowUs the current time in microseconds
+     * @return The number of bytes written; 0 if nothing was due
+     */
+    size_t poll(const uint32_t nowUs)
+    {
+        if (m_Count == 0 || nowUs - m_OpenedUs < m_DeadlineUs)
+        {
+            return 0;
+        }
+        m_Stats.deadlineFlushes++;
+        return flush(nowUs);
+    }
+
+    /**
+     * <b>Encode and write the current batch now.</b>
+     *
+     * @param nowUs the current time in microseconds, used for the wait statistics
+     * @return The number of bytes written; 0 if the batch was empty
+     */
+    size_t flush(const uint32_t nowUs)
+    {
+        if (m_Count == 0)
+        {
+            return 0;
+        }
+        memcpy(&m_Payload[0], &m_Sequence, sizeof(m_Sequence));
+        m_Payload[2] = m_Count;
+        m_Payload[3] = TELEMETRY_BATCH_VERSION;
+        memcpy(&m_Payload[4], &m_FirstTimestamp, sizeof(m_FirstTimestamp));
+
+        const size_t encoded = cobsEncode(m_Payload, m_Size, m_Encoded, sizeof(m_Encoded));
+        const size_t written = m_Sink.write(m_Encoded, encoded);
+
+        const uint32_t waited = nowUs - m_OpenedUs;
+        m_Stats.maxWaitUs = waited > m_Stats.maxWaitUs ? waited : m_Stats.maxWaitUs;
+        m_Stats.batches++;
+        m_Stats.frames += m_Count;
+        m_Stats.bytes += written;
+        if (written != encoded)
+        {
+            m_Stats.writeErrors++;
+        }
+        m_Sequence++;
+        m_Count = 0;
+        m_Size = 0;
+        return written;
+    }
+
+    /** @return the number of frames waiting in the current batch */
+    [[nodiscard]] size_t getPendingCount() const
+    {
+        return m_Count;
+    }
+
+    /** @return the batch, frame and byte counters */
+    [[nodiscard]] const TelemetryBatcherStats& getStats() const
+    {
+        return m_Stats;
+    }
+
+private:
+    /** The batch being filled, header first. */
+    uint8_t m_Payload[PAYLOAD_SIZE] = {};
+    /** The COBS-encoded batch handed to the sink. */
+    uint8_t m_Encoded[BATCH_SIZE] = {};
+    /** Output batches are written to. */
+    SINK& m_Sink;
+    /** Longest a frame may wait in a batch. */
+    uint32_t m_DeadlineUs;
+    /** Time the first frame of the current batch was appended. */
+    uint32_t m_OpenedUs = 0;
+    /** Timestamp of the first frame of the current batch. */
+    uint32_t m_FirstTimestamp = 0;
+    /** Bytes used in m_Payload, including the header. */
+    size_t m_Size = 0;
+    /** Frames in the current batch. */
+    uint8_t m_Count = 0;
+    /** Sequence number of the current batch. */
+    uint16_t m_Sequence = 0;
+    /** Batch, frame and byte counters. */
+    TelemetryBatcherStats m_Stats;
+};
+
+/**
+ * <b>Receiver side: unpack decoded batches and count the ones lost in between.</b>
+ *
+ * <code>
+ * CobsDecoder<8, 512> decoder;
+ * TelemetryBatchReader reader;
+ * decoder.feed(rx, size);
+ * decoder.getPackets().drain([&](const CobsPacket<512>& packet) {
+ *     reader.read(packet.data, packet.size, [](const CanFrame& frame) { handle(frame); });
+ * });
+ * </code>
+ */
+class TelemetryBatchReader
+{
+public:
+    TelemetryBatchReader() = default;
+
+    // Delete copy and move constructors/operators
+
+    TelemetryBatchReader(const TelemetryBatchReader&) = delete;
+    TelemetryBatchReader& operator=(const TelemetryBatchReader&) = delete;
+    TelemetryBatchReader(TelemetryBatchReader&&) = delete;
+    TelemetryBatchReader& operator=(TelemetryBatchReader&&) = delete;
+
+    /**
+     * <b>Unpack one decoded batch and hand its frames to a handler.</b>
+     *
+     * @tparam HANDLER any callable taking a const CanFrame&; frame timestamps are restored from the batch
+     * @param data the decoded batch
+     * @param size the length of the decoded batch
+     * @param handler the callable invoked once per frame, in order
+     * @return false if the batch is malformed, in which case no frame is handed over; true otherwise
+     */
+    template <typename HANDLER> bool read(const uint8_t* data, const size_t size, HANDLER&& handler)
+    {
+        if (!validate(data, size))
+        {
+            m_Malformed++;
+            return false;
+        }
+
+        uint16_t sequence;
+        uint32_t firstTimestamp;
+        memcpy(&sequence, &data[0], sizeof(sequence));
+        memcpy(&firstTimestamp, &data[4], sizeof(firstTimestamp));
+        if (m_Started && sequence != m_NextSequence)
+        {
+            m_Lost += static_cast<uint16_t>(sequence - m_NextSequence);
+        }
+        m_Started = true;
+        m_NextSequence = sequence + 1;
+        m_Batches++;
+
+        size_t offset = TELEMETRY_BATCH_HEADER_SIZE;
+        for (uint8_t i = 0; i < data[2]; i++)
+        {
+            CanFrame frame;
+            uint32_t delta;
+            uint32_t id;
+            memcpy(&delta, &data[offset], sizeof(delta));
+            memcpy(&id, &data[offset + 4], sizeof(id));
+            frame.timestamp = firstTimestamp + delta;
+            frame.id = id & ~TELEMETRY_EXTENDED_FLAG;
+            frame.extended = (id & TELEMETRY_EXTENDED_FLAG) != 0;
+            frame.len = data[offset + 8];
+            memcpy(frame.buf, &data[offset + TELEMETRY_RECORD_HEADER_SIZE], frame.len);
+            offset += TELEMETRY_RECORD_HEADER_SIZE + frame.len;
+            m_Frames++;
+            handler(static_cast<const CanFrame&>(frame));
+        }
+        return true;
+    }
+
+    /** @return the number of batches read */
+    [[nodiscard]] uint32_t getBatchCount() const
+    {
+        return m_Batches;
+    }
+
+    /** @return the number of frames read */
+    [[nodiscard]] uint32_t getFrameCount() const
+    {
+        return m_Frames;
+    }
+
+    /** @return the number of batches missing from the sequence */
+    [[nodiscard]] uint32_t getLostCount() const
+    {
+        return m_Lost;
+    }
+
+    /** @return the number of batches rejected as malformed */
+    [[nodiscard]] uint32_t getMalformedCount() const
+    {
+        return m_Malformed;
+    }
+
+private:
+    /** @return true if every record of the batch lies within it and the version is known */
+    static bool validate(const uint8_t* data, const size_t size)
+    {
+        if (size < TELEMETRY_BATCH_HEADER_SIZE || data[3] != TELEMETRY_BATCH_VERSION)
+        {
+            return false;
+        }
+        size_t offset = TELEMETRY_BATCH_HEADER_SIZE;
+        for (uint8_t i = 0; i < data[2]; i++)
+        {
+            if (offset + TELEMETRY_RECORD_HEADER_SIZE > size || data[offset + 8] > CAN_MAX_DLC)
+            {
+                return false;
+            }
+            offset += TELEMETRY_RECORD_HEADER_SIZE + data[offset + 8];
+        }
+        return offset == size;
+    }
+
+    /** Sequence number expected next. */
+    uint16_t m_NextSequence = 0;
+    /** True once the first batch was read. */
+    bool m_Started = false;
+    /** Batches read. */
+    uint32_t m_Batches = 0;
+    /** Frames read. */
+    uint32_t m_Frames = 0;
+    /** Batches missing from the sequence. */
+    uint32_t m_Lost = 0;
+    /** Batches rejected as malformed. */
+    uint32_t m_Malformed = 0;
+};
+
+#endif //TELEMETRYBATCHER_H
@@ -0,0 +1,321 @@
+#ifndef THROTTLEPLAUSIBILITY_H
+#define THROTTLEPLAUSIBILITY_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "FaultEngine.h"
+#include "MessageCodecs.h"
+
+/** Pedal travel of a fully pressed throttle, in hundredths of a percent. */
+constexpr int32_t THROTTLE_TRAVEL_FULL = 10000;
+
+/**
+ * <b>Streaming plausibility check of the two throttle position sensors.</b>
+ *
+ * Each raw sample is normalized against its sensor's calibration to pedal travel in hundredths of a percent, using a
+ * fixed-point scale factor worked out once per calibration, so a sample costs a multiply and a shift and no
+ * division or floating point. Every sample then evaluates three conditions, each against the same time window:
+ *
+ * - ThrottleMismatchId: the two sensors disagree by more than the threshold (10 % pedal travel by default)
+ * - Throttle1ZeroId / Throttle2ZeroId: a sensor reads outside its calibrated range by more than the range margin,
+ *   which is what an open or shorted sensor looks like
+ *
+ * A condition is reported to the FaultEngine as present only once it has held for longer than the window (100 ms by
+ * default), and as absent as soon as it stops holding, so the FaultEngine's debounce and latching apply on top.
+ * While any of the three faults is active, getTravel() returns 0.
+ *
+ * <code>
+ * FaultEngine faults;
+ * ThrottlePlausibility throttle(faults);
+ * throttle.setCalibration(0, 410, 3680);
+ * throttle.setCalibration(1, 400, 3700);
+ * ...
+ * throttle.handleFrame(rxFrame, micros());
+ * const int32_t travel = throttle.getTravel();
+ * </code>
+ */
+class ThrottlePlausibility
+{
+public:
+    /** Number of throttle position sensors. */
+    static constexpr size_t SENSOR_COUNT = 2;
+
+    /**
+     * @param faults the fault engine the three throttle faults are reported to
+     * @param windowUs how long a condition must hold before it is reported, in microseconds
+     * @param thresholdTravel the largest allowed disagreement, in hundredths of a percent of pedal travel
+     * @param marginTravel how far outside its calibration a sensor may read, in hundredths of a percent
+     */
+    explicit ThrottlePlausibility(FaultEngine& faults, const uint32_t windowUs = 100000,
+                                  const int32_t thresholdTravel = 1000, const int32_t marginTravel = 500)
+        : m_Faults(faults), m_WindowUs(windowUs), m_ThresholdTravel(thresholdTravel), m_MarginTravel(marginTravel)
+    {
+        m_Sensors[0].followsDash = true;
+    }
+
+    // Delete copy and move constructors/operators
+
+    ThrottlePlausibility(const ThrottlePlausibility&) = delete;
+    ThrottlePlausibility& operator=(const ThrottlePlausibility&) = delete;
+    ThrottlePlausibility(ThrottlePlausibility&&) = delete;
+    ThrottlePlausibility& operator=(ThrottlePlausibility&&) = delete;
+
+    /**
+     * <b>Set the raw readings of one sensor at rest and fully pressed.</b>
+     *
+     * A sensor whose reading falls as the pedal is pressed is calibrated with rest above full.
+     *
+     * @param sensor 0 for throttle 1, 1 for throttle 2
+     * @param rest the raw reading with the pedal released
+     * @param full the raw reading with the pedal fully pressed
+     * @return false if the sensor doesn't exist or rest equals full, true otherwise
+     */
+    bool setCalibration(const size_t sensor, const uint16_t rest, const uint16_t full)
+    {
+        if (sensor >= SENSOR_COUNT || rest == full)
+        {
+            return false;
+        }
+        Sensor& calibrated = m_Sensors[sensor];
+        calibrated.rest = rest;
+        calibrated.full = full;
+        calibrated.hasRest = true;
+        calibrated.hasFull = true;
+        return calibrate(calibrated);
+    }
+
+    /**
+     * <b>Choose whether ThrottleMinId and ThrottleMaxId frames calibrate a sensor.</b>
+     *
+     * The Dash sends a single raw reading for rest and one for full, which only fits sensors that share a range and
+     * direction. By default they calibrate throttle 1 only, so a separately calibrated (e.g. inverted) throttle 2
+     * keeps its calibration.
+     *
+     * @param sensor 0 for throttle 1, 1 for throttle 2
+     * @param follows true to apply the Dash's calibration frames to the sensor
+     * @return false if the sensor doesn't exist, true otherwise
+     */
+    bool setFollowsDashCalibration(const size_t sensor, const bool follows)
+    {
+        if (sensor >= SENSOR_COUNT)
+        {
+            return false;
+        }
+        m_Sensors[sensor].followsDash = follows;
+        return true;
+    }
+
+    /**
+     * <b>Consume a received frame.</b>
+     *
+     * Throttle1PositionId and Throttle2PositionId frames are evaluated as samples. ThrottleMinId and ThrottleMaxId
+     * frames set the rest and full reading of every sensor that follows the Dash calibration (see
+     * setFollowsDashCalibration()); a sensor is calibrated once both have arrived.
+     *
+     * @param frame the received frame
+     * @param nowUs the receive time in microseconds
+     * @return false if the frame was none of the above or didn't decode, true otherwise
+     */
+    bool handleFrame(const CanFrame& frame, const uint32_t nowUs)
+    {
+        switch (frame.id)
+        {
+        case Throttle1PositionId:
+        {
+            Throttle1PositionMessage message;
+            if (!unpack(frame, message))
+            {
+                return false;
+            }
+            update(0, message.position, nowUs);
+            return true;
+        }
+        case Throttle2PositionId:
+        {
+            Throttle2PositionMessage message;
+            if (!unpack(frame, message))
+            {
+                return false;
+            }
+            update(1, message.position, nowUs);
+            return true;
+        }
+        case ThrottleMinId:
+        {
+            ThrottleMinMessage message;
+            if (!unpack(frame, message))
+            {
+                return false;
+            }
+            for (Sensor& sensor : m_Sensors)
+            {
+                if (sensor.followsDash)
+                {
+                    sensor.rest = message.raw;
+                    sensor.hasRest = true;
+                    calibrate(sensor);
+                }
+            }
+            return true;
+        }
+        case ThrottleMaxId:
+        {
+            ThrottleMaxMessage message;
+            if (!unpack(frame, message))
+            {
+                return false;
+            }
+            for (Sensor& sensor : m_Sensors)
+            {
+                if (sensor.followsDash)
+                {
+                    sensor.full = message.raw;
+                    sensor.hasFull = true;
+                    calibrate(sensor);
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * <b>Evaluate a new raw sample of one sensor against the latest sample of the other.</b>
+     *
+     * Runs in constant time. The mismatch check waits until both sensors have been sampled at least once.
+     *
+     * @param sensor 0 for throttle 1, 1 for throttle 2
+     * @param raw the raw sensor reading
+     * @param nowUs the sample time in microseconds
+     */
+    void update(const size_t sensor, const uint16_t raw, const uint32_t nowUs)
+    {
+        if (sensor >= SENSOR_COUNT || !m_Sensors[sensor].calibrated)
+        {
+            return;
+        }
+        Sensor& sampled = m_Sensors[sensor];
+        sampled.travel = normalize(sampled, raw);
+        sampled.sampled = true;
+
+        const bool outOfRange =
+            sampled.travel < -m_MarginTravel || sampled.travel > THROTTLE_TRAVEL_FULL + m_MarginTravel;
+        report(sensor == 0 ? Throttle1ZeroId : Throttle2ZeroId, m_RangeWindows[sensor], outOfRange, nowUs);
+
+        const Sensor& other = m_Sensors[sensor ^ 1];
+        if (other.sampled)
+        {
+            const int32_t difference = sampled.travel - other.travel;
+            const bool mismatch = difference > m_ThresholdTravel || difference < -m_ThresholdTravel;
+            report(ThrottleMismatchId, m_MismatchWindow, mismatch, nowUs);
+        }
+    }
+
+    /**
+     * @param sensor 0 for throttle 1, 1 for throttle 2
+     * @return the sensor's latest pedal travel in hundredths of a percent, unclamped; 0 if never sampled
+     */
+    [[nodiscard]] int32_t getSensorTravel(const size_t sensor) const
+    {
+        return sensor < SENSOR_COUNT ? m_Sensors[sensor].travel : 0;
+    }
+
+    /**
+     * @return the lower of the two sensors' pedal travel, clamped to [0, THROTTLE_TRAVEL_FULL], in hundredths of a
+     * percent; 0 while a throttle fault is active or before both sensors were sampled
+     */
+    [[nodiscard]] int32_t getTravel() const
+    {
+        constexpr uint8_t THROTTLE_FAULTS =
+            faultBit(ThrottleMismatchId) | faultBit(Throttle1ZeroId) | faultBit(Throttle2ZeroId);
+        if ((m_Faults.getActiveMask() & THROTTLE_FAULTS) != 0 || !m_Sensors[0].sampled || !m_Sensors[1].sampled)
+        {
+            return 0;
+        }
+        const int32_t lower = m_Sensors[0].travel < m_Sensors[1].travel ? m_Sensors[0].travel : m_Sensors[1].travel;
+        return lower < 0 ? 0 : (lower > THROTTLE_TRAVEL_FULL ? THROTTLE_TRAVEL_FULL : lower);
+    }
+
+private:
+    /** Fractional bits of the per-sensor scale factor. */
+    static constexpr int SCALE_SHIFT = 16;
+
+    /** Calibration and latest sample of one sensor. */
+    struct Sensor
+    {
+        uint16_t rest = 0;
+        uint16_t full = 0;
+        /** THROTTLE_TRAVEL_FULL / (full - rest), with SCALE_SHIFT fractional bits. */
+        int64_t scale = 0;
+        /** Latest normalized sample. */
+        int32_t travel = 0;
+        bool hasRest = false;
+        bool hasFull = false;
+        bool calibrated = false;
+        bool sampled = false;
+        /** Whether ThrottleMinId and ThrottleMaxId frames calibrate this sensor. */
+        bool followsDash = false;
+    };
+
+    /** Tracks how long a condition has held. */
+    struct Window
+    {
+        /** Time of the first sample of the current run. */
+        uint32_t sinceUs = 0;
+        /** True while the condition holds. */
+        bool holding = false;
+    };
+
+    /** Work out a sensor's scale factor once both ends of its travel are known. */
+    static bool calibrate(Sensor& sensor)
+    {
+        sensor.calibrated = sensor.hasRest && sensor.hasFull && sensor.rest != sensor.full;
+        if (sensor.calibrated)
+        {
+            sensor.scale = (static_cast<int64_t>(THROTTLE_TRAVEL_FULL) << SCALE_SHIFT) / (sensor.full - sensor.rest);
+        }
+        return sensor.calibrated;
+    }
+
+    /** @return the pedal travel of a raw reading, in hundredths of a percent */
+    static int32_t normalize(const Sensor& sensor, const uint16_t raw)
+    {
+        const int64_t offset = static_cast<int32_t>(raw) - sensor.rest;
+        // Round to nearest, symmetrically around zero
+        const int64_t scaled = offset * sensor.scale;
+        const int64_t half = int64_t{1} << (SCALE_SHIFT - 1);
+        return static_cast<int32_t>(scaled >= 0 ? (scaled + half) >> SCALE_SHIFT : -((-scaled + half) >> SCALE_SHIFT));
+    }
+
+    /** Report a condition to the fault engine as present once it has held for longer than the window. */
+    void report(const FaultSourcesIDs source, Window& window, const bool holding, const uint32_t nowUs)
+    {
+        if (holding && !window.holding)
+        {
+            window.sinceUs = nowUs;
+        }
+        window.holding = holding;
+        m_Faults.report(source, holding && nowUs - window.sinceUs > m_WindowUs);
+    }
+
+    /** Fault engine the throttle faults are reported to. */
+    FaultEngine& m_Faults;
+    /** How long a condition must hold before it is reported. */
+    uint32_t m_WindowUs;
+    /** Largest allowed disagreement between the sensors. */
+    int32_t m_ThresholdTravel;
+    /** How far outside its calibration a sensor may read. */
+    int32_t m_MarginTravel;
+    /** Calibration and latest sample of each sensor. */
+    Sensor m_Sensors[SENSOR_COUNT];
+    /** Run of samples where the sensors disagree. */
+    Window m_MismatchWindow;
+    /** Runs of samples where each sensor is out of range. */
+    Window m_RangeWindows[SENSOR_COUNT];
+};
+
+#endif //THROTTLEPLAUSIBILITY_H
@@ -0,0 +1,220 @@
+#ifndef TORQUEMAP_H
+#define TORQUEMAP_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+#include "Reserved.h"
+
+/** Number of DriveModesIDs. */
+constexpr size_t DRIVE_MODE_COUNT = LimpId + 1;
+
+/** Torque value that means 100% of the motor's maximum torque (Q15). */
+constexpr uint16_t TORQUE_FULL_SCALE = 0x7FFF;
+
+/** Number of segments in every pedal-to-torque table; the pedal position's top 4 bits select the segment. */
+constexpr size_t TORQUE_TABLE_SEGMENTS = 16;
+
+/** Pedal-to-torque table: TORQUE_TABLE_SEGMENTS + 1 evenly spaced points of Q15 torque. */
+struct TorqueTable
+{
+    uint16_t points[TORQUE_TABLE_SEGMENTS + 1];
+};
+
+/**
+ * <b>Generate the pedal-to-torque table of a drive mode at compile time.</b>
+ *
+ * The curves, with x the normalized pedal position in [0, 1]:
+ * - FullId: x, linear to full torque
+ * - EnduranceId: 0.7 * x^2, gentle at low pedal to save energy
+ * - SkidPadId: 0.6 * (3x^2 - 2x^3), smooth at both ends for steady-state cornering
+ * - PartyId: x * (2 - x), aggressive early torque
+ * - LimpId: 0.3 * x, limited torque to get the car off track
+ *
+ * @param mode the drive mode to generate the table for; unknown modes get the LimpId table
+ * @return The table of Q15 torque values
+ */
+constexpr TorqueTable makeTorqueTable(const DriveModesIDs mode)
+{
+    TorqueTable table{};
+    for (size_t i = 0; i <= TORQUE_TABLE_SEGMENTS; i++)
+    {
+        // x in Q16, so x * x >> 16 stays in Q16
+        const int64_t x = static_cast<int64_t>(i) * 65536 / TORQUE_TABLE_SEGMENTS;
+        const int64_t x2 = x * x >> 16;
+        const int64_t x3 = x2 * x >> 16;
+        int64_t y = 0;
+        switch (mode)
+        {
+            case FullId: y = x; break;
+            case EnduranceId: y = 7 * x2 / 10; break;
+            case SkidPadId: y = 6 * (3 * x2 - 2 * x3) / 10; break;
+            case PartyId: y = 2 * x - x2; break;
+            default: y = 3 * x / 10; break;
+        }
+        const int64_t torque = y * TORQUE_FULL_SCALE >> 16;
+        table.points[i] = static_cast<uint16_t>(torque > TORQUE_FULL_SCALE ? TORQUE_FULL_SCALE : torque);
+    }
+    return table;
+}
+
+/**
+ * <b>Fixed-point throttle-to-torque mapping for every DriveModesIDs.</b>
+ *
+ * Every mode's table is generated at compile time and lives in flash. A torque lookup normalizes the raw pedal
+ * reading against the ThrottleMin/ThrottleMax calibration and linearly interpolates between two table points, using
+ * only integer multiplies, shifts and clamps - no divisions and no data-dependent branches - so every control cycle
+ * costs the same.
+ *
+ * Recalibration only recomputes the normalization scale; the tables never have to be rebuilt.
+ *
+ * <code>
+ * TorqueMap torqueMap(400, 3600);
+ * torqueMap.setMode(EnduranceId);
+ * const uint16_t torque = torqueMap.torque(analogRead(THROTTLE_PIN));
+ * </code>
+ */
+class TorqueMap
+{
+public:
+    /** Compile-time generated table of every drive mode, indexed by DriveModesIDs. */
+    static constexpr TorqueTable TABLES[DRIVE_MODE_COUNT] = {
+        makeTorqueTable(FullId),
+        makeTorqueTable(EnduranceId),
+        makeTorqueTable(SkidPadId),
+        makeTorqueTable(PartyId),
+        makeTorqueTable(LimpId),
+    };
+
+    /**
+     * A TorqueMap starts in LimpId mode with the given calibration.
+     *
+     * @param rawMin the raw pedal reading at 0% travel
+     * @param rawMax the raw pedal reading at 100% travel
+     */
+    TorqueMap(const uint16_t rawMin, const uint16_t rawMax)
+    {
+        calibrate(rawMin, rawMax);
+    }
+
+    /**
+     * <b>Change the pedal travel calibration.</b>
+     *
+     * This is the only place a division happens. A calibration with rawMax <= rawMin is ignored.
+     *
+     * @param rawMin the raw pedal reading at 0% travel
+     * @param rawMax the raw pedal reading at 100% travel
+     * @return false if the calibration was ignored, true otherwise
+     */
+    bool calibrate(const uint16_t rawMin, const uint16_t rawMax)
+    {
+        if (rawMax <= rawMin)
+        {
+            return false;
+        }
+        m_RawMin = rawMin;
+        m_RawMax = rawMax;
+        // Round the scale up so a reading of rawMax maps exactly onto 0xFFFF
+        const uint32_t span = static_cast<uint32_t>(rawMax - rawMin);
+        m_Scale = ((static_cast<uint32_t>(0xFFFF) << 16) + span - 1) / span;
+        return true;
+    }
+
+    /**
+     * <b>Apply a ThrottleMinId or ThrottleMaxId frame (a single uint16_t raw reading).</b>
+     *
+     * @param frame the received calibration frame
+     * @return false if the frame isn't a calibration frame or would give an invalid calibration, true otherwise
+     */
+    bool applyCalibrationFrame(const CanFrame& frame)
+    {
+        if (frame.id != ThrottleMinId && frame.id != ThrottleMaxId)
+        {
+            return false;
+        }
+        auto unpacker = frame.unpacker();
+        const auto raw = unpacker.unpack<uint16_t>();
+        if (!unpacker)
+        {
+            return false;
+        }
+        return frame.id == ThrottleMinId ? calibrate(raw, m_RawMax) : calibrate(m_RawMin, raw);
+    }
+
+    /**
+     * <b>Select the drive mode whose table torque() uses.</b>
+     *
+     * @param mode the new drive mode; unknown modes are ignored
+     */
+    void setMode(const DriveModesIDs mode)
+    {
+        if (mode < DRIVE_MODE_COUNT)
+        {
+            m_Mode = mode;
+        }
+    }
+
+    /** @return the currently selected drive mode */
+    [[nodiscard]] DriveModesIDs getMode() const
+    {
+        return m_Mode;
+    }
+
+    /**
+     * <b>Normalize a raw pedal reading against the calibration.</b>
+     *
+     * @param raw the raw pedal reading
+     * @return The pedal position in [0, 0xFFFF]; readings outside the calibration are clamped
+     */
+    [[nodiscard]] uint16_t normalize(const uint16_t raw) const
+    {
+        const uint32_t clamped = clamp(raw, m_RawMin, m_RawMax);
+        return static_cast<uint16_t>(((clamped - m_RawMin) * static_cast<uint64_t>(m_Scale)) >> 16);
+    }
+
+    /**
+     * <b>Map a raw pedal reading to a torque command using the current drive mode.</b>
+     *
+     * @param raw the raw pedal reading
+     * @return The torque command as a Q15 fraction of maximum torque, in [0, TORQUE_FULL_SCALE]
+     */
+    [[nodiscard]] uint16_t torque(const uint16_t raw) const
+    {
+        return lookup(TABLES[m_Mode], normalize(raw));
+    }
+
+    /**
+     * <b>Interpolate a table at a normalized pedal position.</b>
+     *
+     * @param table the table to interpolate
+     * @param pedal the pedal position in [0, 0xFFFF]
+     * @return The interpolated Q15 torque
+     */
+    static uint16_t lookup(const TorqueTable& table, const uint16_t pedal)
+    {
+        const uint32_t segment = pedal >> 12;
+        const int32_t fraction = pedal & 0x0FFF;
+        const int32_t low = table.points[segment];
+        const int32_t high = table.points[segment + 1];
+        return static_cast<uint16_t>(low + (((high - low) * fraction) >> 12));
+    }
+
+private:
+    static uint32_t clamp(const uint32_t value, const uint32_t low, const uint32_t high)
+    {
+        const uint32_t raised = value < low ? low : value;
+        return raised > high ? high : raised;
+    }
+
+    /** Raw pedal reading at 0% travel. */
+    uint16_t m_RawMin = 0;
+    /** Raw pedal reading at 100% travel. */
+    uint16_t m_RawMax = 0xFFFF;
+    /** Q16 factor that maps (raw - m_RawMin) onto [0, 0xFFFF]. */
+    uint32_t m_Scale = 0x10000;
+    /** Drive mode whose table torque() uses. */
+    DriveModesIDs m_Mode = LimpId;
+};
+
+#endif //TORQUEMAP_H
@@ -0,0 +1,308 @@
+#ifndef TXSCHEDULER_H
+#define TXSCHEDULER_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "CanFrame.h"
+
+/** One row of a periodic transmit table: which ID to send and how often. */
+struct TxRate
+{
+    /** Arbitration ID to transmit, usually one of the ReservedIDs. */
+    uint32_t id;
+    /** Transmit period in milliseconds; must be at least 1. */
+    uint32_t periodMs;
+};
+
+/**
+ * <b>Periodic transmit scheduler driven by a table of per-ID rates.</b>
+ *
+ * Entries live on a timer wheel with one slot per millisecond, so each tick only touches the entries that are due in
+ * that slot. When begin() is called, every entry is given a phase offset within its period that spreads transmissions
+ * as evenly as possible over the wheel, which keeps frames with the same rate from bunching onto the same millisecond.
+ *
+ * Deadlines advance by exactly one period each time an entry fires, so the schedule never drifts with loop() jitter.
+ *
+ * When an entry is due, the scheduler reserves a slot in the TX queue and calls the pack callback to fill it in
+ * place, so the payload is written straight into the outgoing mailbox without an intermediate copy.
+ *
+ * <code>
+ * constexpr TxRate RATES[] = {{Throttle1PositionId, 5}, {BrakePressureId, 5}, {SteeringWheelAngleId, 10}};
+ * TxScheduler<8> scheduler(RATES, packSensor, nullptr);
+ * scheduler.begin(millis());
+ * ...
+ * scheduler.tick(millis(), txRing);
+ * </code>
+ * @tparam MAX_ENTRIES the maximum number of IDs that can be scheduled
+ * @tparam WHEEL_SLOTS the number of one-millisecond wheel slots; must be a power of two
+ */
+template <size_t MAX_ENTRIES, size_t WHEEL_SLOTS = 256> class TxScheduler
+{
+    static_assert(WHEEL_SLOTS > 0 && (WHEEL_SLOTS & (WHEEL_SLOTS - 1)) == 0, "TxScheduler WHEEL_SLOTS must be a power of two");
+    static_assert(MAX_ENTRIES < 0xFFFF, "TxScheduler MAX_ENTRIES must fit in a 16-bit index");
+
+public:
+    /**
+     * Called when an ID is due. The callback packs the payload directly into mailbox (id is already set)
+     * and returns false to skip this transmission.
+     */
+    using PackCallback = bool (*)(uint32_t id, CanFrame& mailbox, void* context);
+
+    /**
+     * A TxScheduler constructed without a rate table starts empty; use add() to fill it before begin().
+     */
+    TxScheduler(const PackCallback pack, void* context) : m_Pack(pack), m_Context(context)
+    {
+        clearWheel();
+    }
+
+    /**
+     * A TxScheduler constructed with a rate table adds every row of the table. Rows past MAX_ENTRIES are ignored.
+     */
+    template <size_t TABLE_SIZE>
+    TxScheduler(const TxRate (&table)[TABLE_SIZE], const PackCallback pack, void* context) : TxScheduler(pack, context)
+    {
+        for (size_t i = 0; i < TABLE_SIZE; i++)
+        {
+            add(table[i].id, table[i].periodMs);
+        }
+    }
+
+    // Delete copy and move constructors/operators
+
+    TxScheduler(const TxScheduler&) = delete;
+    TxScheduler& operator=(const TxScheduler&) = delete;
+    TxScheduler(TxScheduler&&) = delete;
+    TxScheduler& operator=(TxScheduler&&) = delete;
+
+    /**
+     * <b>Add an ID to the schedule.</b>
+     *
+     * Must be called before begin(); entries added afterwards are not armed until begin() is called again.
+     *
+     * @param id the arbitration ID to transmit
+     * @param periodMs the transmit period in milliseconds; must be at least 1
+     * @return false if the table is full or the period is 0, true otherwise
+     */
+    bool add(const uint32_t id, const uint32_t periodMs)
+    {
+        if (m_Count >= MAX_ENTRIES || periodMs == 0)
+        {
+            return false;
+        }
+        Entry& entry = m_Entries[m_Count++];
+        entry.id = id;
+        entry.periodMs = periodMs;
+        entry.offsetMs = 0;
+        entry.deadline = 0;
+        entry.next = NONE;
+        return true;
+    }
+
+    /**
+     * <b>Stagger every entry's phase and arm the wheel starting at nowMs.</b>
+     *
+     * Entries are placed shortest period first, each at the offset within its period whose slots currently carry the
+     * least load. This runs once at startup and costs O(entries * WHEEL_SLOTS).
+     *
+     * @param nowMs the current time in milliseconds
+     */
+    void begin(const uint32_t nowMs)
+    {
+        clearWheel();
+        m_Current = nowMs;
+
+        // Order entries by period so the most frequent (most constraining) IDs pick their phase first
+        uint16_t order[MAX_ENTRIES > 0 ? MAX_ENTRIES : 1];
+        for (uint16_t i = 0; i < m_Count; i++)
+        {
+            uint16_t j = i;
+            while (j > 0 && m_Entries[order[j - 1]].periodMs > m_Entries[i].periodMs)
+            {
+                order[j] = order[j - 1];
+                j--;
+            }
+            order[j] = i;
+        }
+
+        uint16_t load[WHEEL_SLOTS] = {};
+        for (uint16_t i = 0; i < m_Count; i++)
+        {
+            Entry& entry = m_Entries[order[i]];
+            const uint32_t span = entry.periodMs < WHEEL_SLOTS ? entry.periodMs : WHEEL_SLOTS;
+            uint32_t bestOffset = 0;
+            uint32_t bestCost = UINT32_MAX;
+            for (uint32_t offset = 0; offset < span; offset++)
+            {
+                uint32_t cost = 0;
+                for (uint32_t slot = offset; slot < WHEEL_SLOTS; slot += entry.periodMs)
+                {
+                    cost += load[slot];
+                }
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestOffset = offset;
+                }
+            }
+            for (uint32_t slot = bestOffset; slot < WHEEL_SLOTS; slot += entry.periodMs)
+            {
+                load[slot]++;
+            }
+            entry.offsetMs = bestOffset;
+            entry.deadline = nowMs + bestOffset;
+            link(order[i]);
+        }
+    }
+
+    /**
+     * <b>Advance the wheel to nowMs and transmit every ID that became due.</b>
+     *
+     * Each elapsed millisecond costs one slot visit, so calling this every loop() keeps the work per call constant.
+     * If the loop stalled past an entry's deadline it fires once, late, and skips the periods it missed; a stall longer
+     * than the wheel visits each slot once rather than every elapsed millisecond.
+     *
+     * @tparam TX_QUEUE any queue with FrameRing's acquire()/commit() producer interface
+     * @param nowMs the current time in milliseconds
+     * @param txQueue the queue whose slots act as TX mailboxes
+     */
+    template <typename TX_QUEUE> void tick(const uint32_t nowMs, TX_QUEUE& txQueue)
+    {
+        if (static_cast<int32_t>(nowMs - m_Current) < 0)
+        {
+            return;
+        }
+        // Every entry's deadline is at least m_Current, so the last WHEEL_SLOTS milliseconds cover every due entry
+        if (nowMs - m_Current >= WHEEL_SLOTS)
+        {
+            m_Current = nowMs - MASK;
+        }
+        while (static_cast<int32_t>(nowMs - m_Current) >= 0)
+        {
+            const size_t slot = m_Current & MASK;
+            uint16_t index = m_Wheel[slot];
+            m_Wheel[slot] = NONE;
+            while (index != NONE)
+            {
+                Entry& entry = m_Entries[index];
+                const uint16_t next = entry.next;
+                if (static_cast<int32_t>(entry.deadline - nowMs) <= 0)
+                {
+                    fire(entry, txQueue);
+                    entry.deadline += entry.periodMs;
+                    if (static_cast<int32_t>(entry.deadline - nowMs) <= 0)
+                    {
+                        // Loop stalled for more than a period - skip the missed transmissions
+                        const uint32_t missed = (nowMs - entry.deadline) / entry.periodMs + 1;
+                        entry.deadline += missed * entry.periodMs;
+                        m_Overruns += missed;
+                    }
+                }
+                link(index);
+                index = next;
+            }
+            m_Current++;
+        }
+    }
+
+    /** @return the number of scheduled IDs */
+    [[nodiscard]] size_t size() const
+    {
+        return m_Count;
+    }
+
+    /** @return the phase offset, in milliseconds, that begin() assigned to the entry for id; 0 if it isn't scheduled */
+    [[nodiscard]] uint32_t getOffset(const uint32_t id) const
+    {
+        for (size_t i = 0; i < m_Count; i++)
+        {
+            if (m_Entries[i].id == id)
+            {
+                return m_Entries[i].offsetMs;
+            }
+        }
+        return 0;
+    }
+
+    /** @return the number of transmissions skipped because tick() was called too late */
+    [[nodiscard]] uint32_t getOverrunCount() const
+    {
+        return m_Overruns;
+    }
+
+    /** @return the number of transmissions dropped because the TX queue was full */
+    [[nodiscard]] uint32_t getDropCount() const
+    {
+        return m_Drops;
+    }
+
+private:
+    /** A scheduled ID, linked into the wheel slot of its next deadline. */
+    struct Entry
+    {
+        uint32_t id;
+        uint32_t periodMs;
+        uint32_t offsetMs;
+        /** Absolute time, in milliseconds, of the next transmission. */
+        uint32_t deadline;
+        /** Index of the next entry in the same wheel slot. */
+        uint16_t next;
+    };
+
+    /** Mask that turns a millisecond timestamp into a wheel slot. */
+    static constexpr uint32_t MASK = static_cast<uint32_t>(WHEEL_SLOTS - 1);
+    /** Marker for an empty slot or the end of a slot's list. */
+    static constexpr uint16_t NONE = 0xFFFF;
+
+    void clearWheel()
+    {
+        for (size_t i = 0; i < WHEEL_SLOTS; i++)
+        {
+            m_Wheel[i] = NONE;
+        }
+    }
+
+    /** Push an entry onto the front of the wheel slot for its deadline. */
+    void link(const uint16_t index)
+    {
+        const size_t slot = m_Entries[index].deadline & MASK;
+        m_Entries[index].next = m_Wheel[slot];
+        m_Wheel[slot] = index;
+    }
+
+    template <typename TX_QUEUE> void fire(const Entry& entry, TX_QUEUE& txQueue)
+    {
+        CanFrame* mailbox = txQueue.acquire();
+        if (mailbox == nullptr)
+        {
+            m_Drops++;
+            return;
+        }
+        *mailbox = CanFrame{};
+        mailbox->id = entry.id;
+        if (m_Pack(entry.id, *mailbox, m_Context))
+        {
+            txQueue.commit();
+        }
+    }
+
+    /** Callback that fills a mailbox for a due ID. */
+    PackCallback m_Pack;
+    /** Opaque pointer handed back to m_Pack. */
+    void* m_Context;
+    /** Scheduled IDs; only the first m_Count are in use. */
+    Entry m_Entries[MAX_ENTRIES > 0 ? MAX_ENTRIES : 1] = {};
+    /** Number of scheduled IDs. */
+    uint16_t m_Count = 0;
+    /** Head entry index of each wheel slot's list. */
+    uint16_t m_Wheel[WHEEL_SLOTS];
+    /** The next millisecond the wheel will process. */
+    uint32_t m_Current = 0;
+    /** Number of transmissions skipped because tick() was called too late. */
+    uint32_t m_Overruns = 0;
+    /** Number of transmissions dropped because the TX queue was full. */
+    uint32_t m_Drops = 0;
+};
+
+#endif //TXSCHEDULER_H
@@ -0,0 +1,381 @@
+#ifndef VIRTUALCANBUS_H
+#define VIRTUALCANBUS_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "BusLoad.h"
+#include "CanFrame.h"
+#include "FrameRing.h"
+#include "VirtualClock.h"
+
+/** Counters kept by every VirtualCanBus node. */
+struct VirtualCanNodeStats
+{
+    /** Frames this node put on the bus. */
+    uint32_t txFrames = 0;
+    /** Frames this node received from other nodes. */
+    uint32_t rxFrames = 0;
+    /** Frames refused by write() because the TX queue was full. */
+    uint32_t txDrops = 0;
+    /** Times one of this node's frames lost arbitration. */
+    uint32_t arbitrationLosses = 0;
+};
+
+/** Counters kept by a VirtualCanBus. */
+struct VirtualCanBusStats
+{
+    /** Frames transmitted. */
+    uint32_t frames = 0;
+    /** Bits transmitted, including stuff bits and interframe space. */
+    uint64_t bits = 0;
+    /** Time the bus spent transmitting, in nanoseconds. */
+    uint64_t busyNs = 0;
+    /** Sum of the time from write() to the end of transmission, in nanoseconds. */
+    uint64_t totalLatencyNs = 0;
+    /** Longest time from write() to the end of transmission, in nanoseconds. */
+    uint64_t maxLatencyNs = 0;
+};
+
+/**
+ * <b>Deterministic, in-process simulated CAN bus for host builds.</b>
+ *
+ * Nodes attached to the bus expose the same write()/read() interface as the hardware driver, so code that talks to
+ * a CAN controller can talk to a node instead. Time comes from a VirtualClock:
+ *
+ * - write() queues a frame in the node's TX queue, stamped with the current clock time
+ * - step() arbitrates between the pending frames of every node (lowest arbitration field wins, standard before
+ *   extended on a tie of the base ID), transmits the winner for its exact on-wire bit count at the configured bit rate,
+ *   advances the clock to the end of the frame and delivers it to every other node's RX queue
+ * - read() takes received frames out of the node's RX queue
+ *
+ * Because nothing depends on wall-clock time or threads, every run is identical and throughput and latency of the
+ * whole stack can be measured without hardware.
+ *
+ * <code>
+ * VirtualClock clock;
+ * VirtualCanBus<> bus(clock);
+ * auto* vcu = bus.attach();
+ * auto* dash = bus.attach();
+ * vcu->write(frame);
+ * bus.runUntilIdle();
+ * dash->read(received);
+ * </code>
+ * @tparam MAX_NODES the maximum number of nodes that can be attached
+ * @tparam QUEUE_SIZE the number of frames each node's TX and RX queues hold; the RX size must be a power of two
+ */
+template <size_t MAX_NODES = 8, size_t QUEUE_SIZE = 64> class VirtualCanBus
+{
+public:
+    /** A node on the simulated bus. */
+    class Node
+    {
+    public:
+        Node() = default;
+
+        // Delete copy and move constructors/operators
+
+        Node(const Node&) = delete;
+        Node& operator=(const Node&) = delete;
+        Node(Node&&) = delete;
+        Node& operator=(Node&&) = delete;
+
+        /**
+         * <b>Queue a frame for transmission, like the hardware driver's write().</b>
+         *
+         * @param frame the frame to transmit
+         * @return 1 if the frame was queued, 0 if the TX queue is full
+         */
+        int write(const CanFrame& frame)
+        {
+            if (m_Bus == nullptr || m_TxCount >= QUEUE_SIZE)
+            {
+                m_Stats.txDrops++;
+                return 0;
+            }
+            m_Tx[m_TxCount++] = {frame, m_Bus->nowNs()};
+            return 1;
+        }
+
+        /**
+         * <b>Take the oldest received frame, like the hardware driver's read().</b>
+         *
+         * @param frame receives the frame
+         * @return 1 if a frame was read, 0 if none are waiting
+         */
+        int read(CanFrame& frame)
+        {
+            return m_Rx.pop(frame) ? 1 : 0;
+        }
+
+        /** @return the number of frames waiting to be transmitted */
+        [[nodiscard]] size_t getPendingCount() const
+        {
+            return m_TxCount;
+        }
+
+        /** @return the node's counters */
+        [[nodiscard]] const VirtualCanNodeStats& getStats() const
+        {
+            return m_Stats;
+        }
+
+        /** @return the node's RX queue, for batch draining or reading its drop counters */
+        FrameRing<QUEUE_SIZE>& getRxQueue()
+        {
+            return m_Rx;
+        }
+
+    private:
+        friend class VirtualCanBus;
+
+        /** A frame waiting in the TX queue. */
+        struct Pending
+        {
+            CanFrame frame;
+            uint64_t queuedNs;
+        };
+
+        /** @return the index of the pending frame that wins arbitration within this node */
+        size_t lowestPending() const
+        {
+            size_t best = 0;
+            for (size_t i = 1; i < m_TxCount; i++)
+            {
+                if (arbitrationKey(m_Tx[i].frame) < arbitrationKey(m_Tx[best].frame))
+                {
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        /** Remove the pending frame at index, keeping the others in order. */
+        void removePending(const size_t index)
+        {
+            for (size_t i = index + 1; i < m_TxCount; i++)
+            {
+                m_Tx[i - 1] = m_Tx[i];
+            }
+            m_TxCount--;
+        }
+
+        /** Bus this node is attached to. */
+        VirtualCanBus* m_Bus = nullptr;
+        /** Frames waiting to be transmitted, in write() order. */
+        Pending m_Tx[QUEUE_SIZE] = {};
+        /** Number of frames in m_Tx. */
+        size_t m_TxCount = 0;
+        /** Frames received from other nodes. */
+        FrameRing<QUEUE_SIZE> m_Rx;
+        /** Counters. */
+        VirtualCanNodeStats m_Stats;
+    };
+
+    /**
+     * @param clock the clock the bus reads and advances
+     * @param bitRate the bus bit rate in bits per second; defaults to 1 Mbit/s
+     */
+    explicit VirtualCanBus(VirtualClock& clock, const uint32_t bitRate = 1000000)
+        : m_Clock(clock), m_BitTimeNs(1000000000ull / (bitRate > 0 ? bitRate : 1))
+    {
+    }
+
+    // Delete copy and move constructors/operators
+
+    VirtualCanBus(const VirtualCanBus&) = delete;
+    VirtualCanBus& operator=(const VirtualCanBus&) = delete;
+    VirtualCanBus(VirtualCanBus&&) = delete;
+    VirtualCanBus& operator=(VirtualCanBus&&) = delete;
+
+    /**
+     * <b>Attach a new node to the bus.</b>
+     *
+     * @return A pointer to the node; nullptr if MAX_NODES nodes are already attached
+     */
+    Node* attach()
+    {
+        if (m_NodeCount >= MAX_NODES)
+        {
+            return nullptr;
+        }
+        Node& node = m_Nodes[m_NodeCount++];
+        node.m_Bus = this;
+        return &node;
+    }
+
+    /**
+     * <b>Arbitrate and transmit a single frame.</b>
+     *
+     * The frame starts when both the clock and the bus are free, and the clock ends up at the end of the frame.
+     *
+     * @return false if no node had a frame to send, true otherwise
+     */
+    bool step()
+    {
+        Node* winner = nullptr;
+        size_t winnerIndex = 0;
+        for (size_t n = 0; n < m_NodeCount; n++)
+        {
+            Node& node = m_Nodes[n];
+            if (node.m_TxCount == 0)
+            {
+                continue;
+            }
+            const size_t index = node.lowestPending();
+            if (winner == nullptr || arbitrationKey(node.m_Tx[index].frame) < arbitrationKey(winner->m_Tx[winnerIndex].frame))
+            {
+                winner = &node;
+                winnerIndex = index;
+            }
+        }
+        if (winner == nullptr)
+        {
+            return false;
+        }
+        for (size_t n = 0; n < m_NodeCount; n++)
+        {
+            if (&m_Nodes[n] != winner && m_Nodes[n].m_TxCount > 0)
+            {
+                m_Nodes[n].m_Stats.arbitrationLosses++;
+            }
+        }
+
+        const typename Node::Pending pending = winner->m_Tx[winnerIndex];
+        winner->removePending(winnerIndex);
+
+        const uint64_t startNs = nowNs() > m_BusFreeNs ? nowNs() : m_BusFreeNs;
+        const uint32_t bits = exactFrameBits(pending.frame);
+        const uint64_t endNs = startNs + bits * m_BitTimeNs;
+        m_BusFreeNs = endNs;
+        setNowNs(endNs);
+
+        const uint64_t latencyNs = endNs - pending.queuedNs;
+        m_Stats.frames++;
+        m_Stats.bits += bits;
+        m_Stats.busyNs += endNs - startNs;
+        m_Stats.totalLatencyNs += latencyNs;
+        m_Stats.maxLatencyNs = latencyNs > m_Stats.maxLatencyNs ? latencyNs : m_Stats.maxLatencyNs;
+        winner->m_Stats.txFrames++;
+
+        CanFrame delivered = pending.frame;
+        delivered.timestamp = m_Clock.micros();
+        for (size_t n = 0; n < m_NodeCount; n++)
+        {
+            if (&m_Nodes[n] != winner && m_Nodes[n].m_Rx.push(delivered))
+            {
+                m_Nodes[n].m_Stats.rxFrames++;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * <b>Transmit frames until no node has anything left to send.</b>
+     *
+     * @return The number of frames transmitted
+     */
+    size_t runUntilIdle()
+    {
+        size_t frames = 0;
+        while (step())
+        {
+            frames++;
+        }
+        return frames;
+    }
+
+    /**
+     * <b>Transmit the pending frames that start before endMicros, then move the clock to endMicros.</b>
+     *
+     * A frame that starts before endMicros but ends after it leaves the clock at the end of that frame.
+     *
+     * @param endMicros the absolute clock time, in microseconds, to run to
+     * @return The number of frames transmitted
+     */
+    size_t runUntil(const uint64_t endMicros)
+    {
+        const uint64_t endNs = endMicros * 1000;
+        size_t frames = 0;
+        while ((nowNs() > m_BusFreeNs ? nowNs() : m_BusFreeNs) < endNs && step())
+        {
+            frames++;
+        }
+        if (nowNs() < endNs)
+        {
+            setNowNs(endNs);
+        }
+        return frames;
+    }
+
+    /** @return true if any node has a frame waiting to be transmitted */
+    [[nodiscard]] bool hasPending() const
+    {
+        for (size_t n = 0; n < m_NodeCount; n++)
+        {
+            if (m_Nodes[n].m_TxCount > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** @return the bus counters */
+    [[nodiscard]] const VirtualCanBusStats& getStats() const
+    {
+        return m_Stats;
+    }
+
+    /**
+     * @param elapsedMicros the length of the measurement period in microseconds
+     * @return the share of elapsedMicros the bus was busy, in tenths of a percent
+     */
+    [[nodiscard]] uint32_t getUtilizationPermille(const uint64_t elapsedMicros) const
+    {
+        return elapsedMicros == 0 ? 0 : static_cast<uint32_t>(m_Stats.busyNs / elapsedMicros);
+    }
+
+private:
+    /**
+     * Key that orders frames like bitwise arbitration does: the 11-bit base ID first, then standard (dominant IDE)
+     * before extended, then the 18-bit ID extension.
+     */
+    static uint64_t arbitrationKey(const CanFrame& frame)
+    {
+        if (frame.extended)
+        {
+            const uint64_t base = (frame.id >> 18) & 0x7FF;
+            return (((base << 1) | 1u) << 18) | (frame.id & 0x3FFFF);
+        }
+        return static_cast<uint64_t>(frame.id & 0x7FF) << 19;
+    }
+
+    uint64_t nowNs() const
+    {
+        return m_Clock.now() * 1000 + m_SubMicroNs;
+    }
+
+    void setNowNs(const uint64_t ns)
+    {
+        m_Clock.set(ns / 1000);
+        m_SubMicroNs = ns % 1000;
+    }
+
+    /** Clock the bus reads and advances. */
+    VirtualClock& m_Clock;
+    /** Length of one bit, in nanoseconds. */
+    uint64_t m_BitTimeNs;
+    /** Nanoseconds past the clock's current microsecond, so bit rates that don't divide 1 MHz stay exact. */
+    uint64_t m_SubMicroNs = 0;
+    /** Time, in nanoseconds, the current transmission ends. */
+    uint64_t m_BusFreeNs = 0;
+    /** Attached nodes; only the first m_NodeCount are in use. */
+    Node m_Nodes[MAX_NODES];
+    /** Number of attached nodes. */
+    size_t m_NodeCount = 0;
+    /** Bus counters. */
+    VirtualCanBusStats m_Stats;
+};
+
+#endif //VIRTUALCANBUS_H
@@ -0,0 +1,65 @@
+#ifndef VIRTUALCLOCK_H
+#define VIRTUALCLOCK_H
+
+#include <cstdint>
+
+/**
+ * <b>Deterministic, manually advanced clock for host builds and testing.</b>
+ *
+ * Time only moves when advance() is called, so anything driven by it (schedulers, watchdogs, simulated buses)
+ * behaves identically on every run. micros() and millis() wrap exactly like their Arduino counterparts.
+ */
+class VirtualClock
+{
+public:
+    /** @param startMicros the time, in microseconds, the clock starts at */
+    explicit VirtualClock(const uint64_t startMicros = 0) : m_Micros(startMicros)
+    {
+    }
+
+    /** @return the current time in microseconds, wrapping at 32 bits like Arduino's micros() */
+    [[nodiscard]] uint32_t micros() const
+    {
+        return static_cast<uint32_t>(m_Micros);
+    }
+
+    /** @return the current time in milliseconds, wrapping at 32 bits like Arduino's millis() */
+    [[nodiscard]] uint32_t millis() const
+    {
+        return static_cast<uint32_t>(m_Micros / 1000);
+    }
+
+    /** @return the current time in microseconds without wrapping */
+    [[nodiscard]] uint64_t now() const
+    {
+        return m_Micros;
+    }
+
+    /** <b>Move the clock forward by a number of microseconds.</b> */
+    void advance(const uint64_t micros)
+    {
+        m_Micros += micros;
+    }
+
+    /** <b>Move the clock forward by a number of milliseconds.</b> */
+    void advanceMillis(const uint64_t millis)
+    {
+        m_Micros += millis * 1000;
+    }
+
+    /**
+     * <b>Jump the clock to an absolute time.</b>
+     *
+     * @param micros the new time in microseconds; moving backwards is allowed but rarely useful
+     */
+    void set(const uint64_t micros)
+    {
+        m_Micros = micros;
+    }
+
+private:
+    /** Current time in microseconds. */
+    uint64_t m_Micros;
+};
+
+#endif //VIRTUALCLOCK_H
@@ -0,0 +1,215 @@
+#ifndef ARDUINO_SHIM_H
+#define ARDUINO_SHIM_H
+
+/*
+ * Minimal stand-in for the Arduino core, so the library and its examples build and run unmodified on a Linux host
+ * (pio run -e native), where they can be profiled with perf and checked with sanitizers.
+ *
+ * Only what the library and examples use is provided: Serial printing and writing to stdout, and millis(), micros(),
+ * delay() and delayMicroseconds() backed by a VirtualClock, so delays return immediately and every run is identical.
+ */
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <math.h>
+
+#include "VirtualClock.h"
+
+/** Defined when building against this shim rather than the real Arduino core. */
+#define ARDUINO_SHIM 1
+
+/** Numeric bases accepted by print(), as in the Arduino core. */
+constexpr int DEC = 10;
+constexpr int HEX = 16;
+constexpr int OCT = 8;
+constexpr int BIN = 2;
+
+/**
+ * <b>Serial port stand-in that writes to stdout.</b>
+ *
+ * print() follows the Arduino Print class: integers in the given base, floating point with a given number of
+ * decimals (2 by default), characters and strings as text.
+ */
+class HostSerial
+{
+public:
+    void begin(const unsigned long)
+    {
+    }
+
+    explicit operator bool() const
+    {
+        return true;
+    }
+
+    size_t write(const uint8_t byte)
+    {
+        return fwrite(&byte, 1, 1, stdout);
+    }
+
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        return fwrite(data, 1, size, stdout);
+    }
+
+    int availableForWrite() const
+    {
+        return 4096;
+    }
+
+    int available() const
+    {
+        return 0;
+    }
+
+    int read()
+    {
+        return -1;
+    }
+
+    void flush()
+    {
+        fflush(stdout);
+    }
+
+    size_t print(const char* text)
+    {
+        return printf("%s", text);
+    }
+
+    size_t print(const char character)
+    {
+        return printf("%c", character);
+    }
+
+    size_t print(const long long value, const int base = DEC)
+    {
+        // Like the Arduino core, other bases print the two's complement bits
+        return base == DEC ? printf("%lld", value) : print(static_cast<unsigned long long>(value), base);
+    }
+
+    size_t print(const unsigned long long value, const int base = DEC)
+    {
+        if (base == DEC)
+        {
+            return printf("%llu", value);
+        }
+        char digits[65];
+        size_t count = 0;
+        unsigned long long remaining = value;
+        do
+        {
+            const int digit = static_cast<int>(remaining % base);
+            digits[count++] = static_cast<char>(digit < 10 ? '0' + digit : 'A' + digit - 10);
+            remaining /= base;
+        } while (remaining != 0);
+        for (size_t i = 0; i < count / 2; i++)
+        {
+            const char swap = digits[i];
+            digits[i] = digits[count - 1 - i];
+            digits[count - 1 - i] = swap;
+        }
+        digits[count] = '\0';
+        return print(static_cast<const char*>(digits));
+    }
+
+    size_t print(const int value, const int base = DEC)
+    {
+        return print(static_cast<long long>(value), base);
+    }
+
+    size_t print(const long value, const int base = DEC)
+    {
+        return print(static_cast<long long>(value), base);
+    }
+
+    size_t print(const unsigned char value, const int base = DEC)
+    {
+        return print(static_cast<unsigned long long>(value), base);
+    }
+
+    size_t print(const unsigned short value, const int base = DEC)
+    {
+        return print(static_cast<unsigned long long>(value), base);
+    }
+
+    size_t print(const short value, const int base = DEC)
+    {
+        return print(static_cast<long long>(value), base);
+    }
+
+    size_t print(const signed char value, const int base = DEC)
+    {
+        return print(static_cast<long long>(value), base);
+    }
+
+    size_t print(const unsigned int value, const int base = DEC)
+    {
+        return print(static_cast<unsigned long long>(value), base);
+    }
+
+    size_t print(const unsigned long value, const int base = DEC)
+    {
+        return print(static_cast<unsigned long long>(value), base);
+    }
+
+    size_t print(const bool value)
+    {
+        return print(static_cast<long long>(value));
+    }
+
+    size_t print(const double value, const int decimals = 2)
+    {
+        return printf("%.*f", decimals, value);
+    }
+
+    template <typename T> size_t println(const T& value)
+    {
+        const size_t count = print(value);
+        return count + println();
+    }
+
+    template <typename T> size_t println(const T& value, const int format)
+    {
+        const size_t count = print(value, format);
+        return count + println();
+    }
+
+    size_t println()
+    {
+        return printf("\r\n");
+    }
+};
+
+/** The host's only serial port. */
+extern HostSerial Serial;
+
+/** @return the clock behind millis(), micros() and delay(); advance it to simulate the passage of time */
+VirtualClock& arduinoClock();
+
+inline uint32_t millis()
+{
+    return arduinoClock().millis();
+}
+
+inline uint32_t micros()
+{
+    return arduinoClock().micros();
+}
+
+inline void delay(const uint32_t ms)
+{
+    arduinoClock().advanceMillis(ms);
+}
+
+inline void delayMicroseconds(const uint32_t us)
+{
+    arduinoClock().advance(us);
+}
+
+void setup();
+void loop();
+
+#endif //ARDUINO_SHIM_H
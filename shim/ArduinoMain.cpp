@@ -0,0 +1,28 @@
+#include <cstdlib>
+
+#include "Arduino.h"
+
+HostSerial Serial;
+
+VirtualClock& arduinoClock()
+{
+    static VirtualClock clock;
+    return clock;
+}
+
+/**
+ * Host entry point: runs setup() once, then loop() ARDUINO_LOOPS times (once if unset), instead of forever.
+ */
+int main()
+{
+    const char* loops = getenv("ARDUINO_LOOPS");
+    const long count = loops != nullptr ? strtol(loops, nullptr, 10) : 1;
+
+    setup();
+    for (long i = 0; i < count; i++)
+    {
+        loop();
+    }
+    Serial.flush();
+    return 0;
+}
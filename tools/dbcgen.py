@@ -0,0 +1,419 @@
+#!/usr/bin/env python3
+"""
+Generate the reserved ID registry and message codecs from a DBC file.
+
+Usage (from the repository root):
+    python3 tools/dbcgen.py dbc/reserved.dbc include
+
+Writes:
+    include/ReservedIds.h    ReservedIDs enum, dense index mapping and per-ID metadata (included by Reserved.h)
+    include/MessageCodecs.h  one struct per message with pack()/unpack() at compile-time offsets
+
+Supported DBC subset: BO_, little-endian (@1) SG_ lines, CM_ BO_ comments (used as enum section headings) and the
+GenMsgCycleTime message attribute. Adding a signal is one SG_ line followed by a re-run of this script.
+"""
+
+import re
+import sys
+from pathlib import Path
+
+MESSAGE_RE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+SIGNAL_RE = re.compile(
+    r'^\s*SG_\s+(\w+)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*\(([^,]+),([^)]+)\)\s*\[([^|]*)\|([^\]]*)\]\s*"([^"]*)"\s*(.*)$')
+COMMENT_RE = re.compile(r'^CM_\s+BO_\s+(\d+)\s+"([^"]*)"\s*;')
+CYCLE_TIME_RE = re.compile(r'^BA_\s+"GenMsgCycleTime"\s+BO_\s+(\d+)\s+(\d+)\s*;')
+
+LINE_WIDTH = 120
+
+
+class Signal:
+    def __init__(self, name, start, length, little_endian, signed, scale, offset, unit):
+        self.name = name
+        self.start = start
+        self.length = length
+        self.little_endian = little_endian
+        self.signed = signed
+        self.scale = scale
+        self.offset = offset
+        self.unit = unit
+
+    @property
+    def ctype(self):
+        if self.length == 1 and not self.signed:
+            return 'bool'
+        for bits in (8, 16, 32, 64):
+            if self.length <= bits:
+                return ('int%d_t' if self.signed else 'uint%d_t') % bits
+        raise ValueError('signal %s is longer than 64 bits' % self.name)
+
+    @property
+    def byte_aligned(self):
+        """True if the signal is a whole, naturally sized integer starting on a byte boundary."""
+        return self.start % 8 == 0 and self.length in (8, 16, 32, 64)
+
+    @property
+    def scaled(self):
+        return self.scale != 1.0 or self.offset != 0.0
+
+    @property
+    def end_byte(self):
+        return (self.start + self.length + 7) // 8
+
+
+class Message:
+    def __init__(self, frame_id, name, dlc, sender):
+        self.frame_id = frame_id
+        self.name = name
+        self.dlc = dlc
+        self.sender = sender
+        self.signals = []
+        self.comment = None
+        self.period_ms = 0
+
+    @property
+    def enum_name(self):
+        return self.name + 'Id'
+
+
+def parse(path):
+    messages = {}
+    current = None
+    for number, line in enumerate(Path(path).read_text().splitlines(), 1):
+        match = MESSAGE_RE.match(line)
+        if match:
+            frame_id, name, dlc, sender = match.groups()
+            current = Message(int(frame_id), name, int(dlc), sender)
+            if current.frame_id in messages:
+                sys.exit('%s:%d: duplicate message ID %d' % (path, number, current.frame_id))
+            messages[current.frame_id] = current
+            continue
+        match = SIGNAL_RE.match(line)
+        if match:
+            if current is None:
+                sys.exit('%s:%d: SG_ outside of a BO_' % (path, number))
+            name, start, length, order, sign, scale, offset, _, _, unit, _ = match.groups()
+            if order != '1':
+                sys.exit('%s:%d: only little-endian (@1) signals are supported' % (path, number))
+            signal = Signal(name, int(start), int(length), True, sign == '-', float(scale), float(offset), unit)
+            if signal.end_byte > current.dlc:
+                sys.exit('%s:%d: signal %s ends past the message DLC' % (path, number, name))
+            current.signals.append(signal)
+            continue
+        match = COMMENT_RE.match(line)
+        if match:
+            messages[int(match.group(1))].comment = match.group(2)
+            continue
+        match = CYCLE_TIME_RE.match(line)
+        if match:
+            messages[int(match.group(1))].period_ms = int(match.group(2))
+            continue
+        if line.strip() == '':
+            current = None
+    return [messages[frame_id] for frame_id in sorted(messages)]
+
+
+def runs(messages):
+    """Split the sorted messages into runs of consecutive IDs: (first ID, first dense index, last ID)."""
+    result = []
+    for index, message in enumerate(messages):
+        if result and message.frame_id == result[-1][2] + 1:
+            result[-1][2] = message.frame_id
+        else:
+            result.append([message.frame_id, index, message.frame_id])
+    return result
+
+
+def wrap(names, indent='    '):
+    lines = []
+    line = indent
+    for name in names:
+        piece = name + ', '
+        if len(line) + len(piece.rstrip()) > LINE_WIDTH and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+        line += piece
+    if line.strip():
+        lines.append(line.rstrip())
+    return lines
+
+
+def float_literal(value):
+    text = repr(float(value))
+    return text + 'f' if ('.' in text or 'e' in text) else text + '.0f'
+
+
+def generate_ids(messages, source):
+    out = []
+    out.append('// Generated by tools/dbcgen.py from %s - do not edit, edit the DBC file and regenerate.' % source)
+    out.append('')
+    out.append('#ifndef RESERVEDIDS_H')
+    out.append('#define RESERVEDIDS_H')
+    out.append('')
+    out.append('#include <cstdint>')
+    out.append('#include <cstddef>')
+    out.append('')
+    out.append('/** CAN Message IDs that are reserved */')
+    out.append('enum ReservedIDs : uint32_t')
+    out.append('{')
+    groups = []
+    previous = None
+    for message in messages:
+        name = message.enum_name
+        if previous is None or message.frame_id != previous + 1:
+            name += '=0x%03X' % message.frame_id if message.frame_id != 0 else ''
+        if message.comment is not None or not groups:
+            groups.append([message.comment, []])
+        groups[-1][1].append(name)
+        previous = message.frame_id
+    for comment, names in groups:
+        if comment:
+            out.append('    // ' + comment)
+            out.append('')
+        out.extend(wrap(names))
+    out.append('')
+    out.append('    // ID for default initializations.')
+    out.append('    INVALIDId=0xFFFFFFFF,')
+    out.append('};')
+    out.append('')
+    out.append('/** Number of ReservedIDs, excluding INVALIDId. */')
+    out.append('constexpr size_t RESERVED_ID_COUNT = %d;' % len(messages))
+    out.append('')
+
+    id_runs = runs(messages)
+    out.append('/**')
+    out.append(' * <b>Map a ReservedIDs value onto a dense index, for per-ID lookup tables.</b>')
+    out.append(' *')
+    out.append(' * @param id any arbitration ID')
+    out.append(' * @return An index in [0, RESERVED_ID_COUNT) for reserved IDs; RESERVED_ID_COUNT for anything else')
+    out.append(' */')
+    out.append('constexpr size_t reservedIdIndex(const uint32_t id)')
+    out.append('{')
+    by_id = {message.frame_id: message for message in messages}
+    for first, index, last in id_runs:
+        first_name, last_name = by_id[first].enum_name, by_id[last].enum_name
+        condition = 'id <= %s' % last_name if first == 0 else 'id >= %s && id <= %s' % (first_name, last_name)
+        out.append('    if (%s)' % condition)
+        out.append('    {')
+        out.append('        return %s;' % ('id' if first == 0 and index == 0 else '%d + (id - %s)' % (index, first_name)))
+        out.append('    }')
+    out.append('    return RESERVED_ID_COUNT;')
+    out.append('}')
+    out.append('')
+    out.append('/**')
+    out.append(' * <b>Map a dense index back onto its ReservedIDs value.</b>')
+    out.append(' *')
+    out.append(' * @param index an index returned by reservedIdIndex()')
+    out.append(' * @return The reserved ID at index; INVALIDId if index is out of range')
+    out.append(' */')
+    out.append('constexpr ReservedIDs reservedIdAt(const size_t index)')
+    out.append('{')
+    for position, (first, index, last) in enumerate(id_runs):
+        end = id_runs[position + 1][1] if position + 1 < len(id_runs) else None
+        bound = 'RESERVED_ID_COUNT' if end is None else str(end)
+        out.append('    if (index < %s)' % bound)
+        out.append('    {')
+        if first == 0 and index == 0:
+            out.append('        return static_cast<ReservedIDs>(index);')
+        else:
+            out.append('        return static_cast<ReservedIDs>(%s + (index - %d));' % (by_id[first].enum_name, index))
+        out.append('    }')
+    out.append('    return INVALIDId;')
+    out.append('}')
+    out.append('')
+    out.append('/** Static description of a reserved ID, from the DBC file. */')
+    out.append('struct ReservedIdInfo')
+    out.append('{')
+    out.append('    ReservedIDs id;')
+    out.append('    /** Message name without the Id suffix. */')
+    out.append('    const char* name;')
+    out.append('    /** Payload length in bytes. */')
+    out.append('    uint8_t dlc;')
+    out.append('    /** Number of signals MessageCodecs.h decodes; 0 for raw or multiplexed payloads. */')
+    out.append('    uint8_t signalCount;')
+    out.append('    /** Transmission period in milliseconds; 0 for event-driven messages. */')
+    out.append('    uint16_t periodMs;')
+    out.append('};')
+    out.append('')
+    out.append('/** Description of every reserved ID, indexed by reservedIdIndex(). */')
+    out.append('inline constexpr ReservedIdInfo RESERVED_ID_INFO[RESERVED_ID_COUNT] = {')
+    for message in messages:
+        out.append('    {%s, "%s", %d, %d, %d},' % (message.enum_name, message.name, message.dlc, len(message.signals),
+                                                  message.period_ms))
+    out.append('};')
+    out.append('')
+    out.append('/** @return the description of id; nullptr if id isn\'t reserved */')
+    out.append('constexpr const ReservedIdInfo* reservedIdInfo(const uint32_t id)')
+    out.append('{')
+    out.append('    return reservedIdIndex(id) < RESERVED_ID_COUNT ? &RESERVED_ID_INFO[reservedIdIndex(id)] : nullptr;')
+    out.append('}')
+    out.append('')
+    out.append('#endif //RESERVEDIDS_H')
+    return '\n'.join(out) + '\n'
+
+
+def shifted(expression, operator, amount):
+    """Shift expression, leaving out shifts by zero."""
+    if amount == 0:
+        return expression
+    return '(%s %s %d)' % (expression, operator, amount) if operator == '>>' else '%s %s %d' % (expression, operator, amount)
+
+
+def constant_name(name):
+    name = re.sub(r'(?<=[a-z0-9])(?=[A-Z])', '_', name)
+    return re.sub(r'(?<=[A-Z])(?=[A-Z][a-z])', '_', name).upper()
+
+
+def accessor_name(name):
+    return name[0].upper() + name[1:]
+
+
+def generate_message(message):
+    out = []
+    struct = message.name + 'Message'
+    word = not all(signal.byte_aligned for signal in message.signals)
+    length = max(signal.end_byte for signal in message.signals)
+
+    out.append('/** %s (0x%03X), %d bytes, sent by %s%s. */' % (
+        message.enum_name, message.frame_id, message.dlc, message.sender,
+        ' every %d ms' % message.period_ms if message.period_ms else ''))
+    out.append('struct %s' % struct)
+    out.append('{')
+    out.append('    static constexpr ReservedIDs ID = %s;' % message.enum_name)
+    out.append('    static constexpr uint8_t DLC = %d;' % message.dlc)
+    for signal in message.signals:
+        if signal.scaled:
+            prefix = constant_name(signal.name)
+            out.append('    static constexpr float %s_SCALE = %s;' % (prefix, float_literal(signal.scale)))
+            out.append('    static constexpr float %s_OFFSET = %s;' % (prefix, float_literal(signal.offset)))
+    out.append('')
+    for signal in message.signals:
+        unit = ', %s' % signal.unit if signal.unit else ''
+        scale = ''
+        if signal.scaled:
+            scale = ', raw * %g' % signal.scale + (' + %g' % signal.offset if signal.offset else '')
+        bits = 'Bit %d' % signal.start if signal.length == 1 else 'Bits %d-%d' % (signal.start, signal.start + signal.length - 1)
+        out.append('    /** %s%s%s. */' % (bits, scale, unit))
+        out.append('    %s %s = %s;' % (signal.ctype, signal.name, 'false' if signal.ctype == 'bool' else '0'))
+    for signal in message.signals:
+        if not signal.scaled:
+            continue
+        prefix = constant_name(signal.name)
+        accessor = accessor_name(signal.name)
+        out.append('')
+        out.append('    /** @return %s in %s */' % (signal.name, signal.unit or 'physical units'))
+        out.append('    [[nodiscard]] float get%s() const' % accessor)
+        out.append('    {')
+        out.append('        return %s * %s_SCALE + %s_OFFSET;' % (signal.name, prefix, prefix))
+        out.append('    }')
+        out.append('')
+        out.append('    /** <b>Set %s from a value in %s, rounding to the nearest raw step.</b> */' % (
+            signal.name, signal.unit or 'physical units'))
+        out.append('    void set%s(const float value)' % accessor)
+        out.append('    {')
+        out.append('        %s = static_cast<%s>(lroundf((value - %s_OFFSET) / %s_SCALE));' % (
+            signal.name, signal.ctype, prefix, prefix))
+        out.append('    }')
+    out.append('};')
+    out.append('')
+
+    # unpack
+    out.append('/**')
+    out.append(' * <b>Unpack the signals of %s.</b>' % message.enum_name)
+    out.append(' *')
+    out.append(' * @return false if the frame has a different ID or is shorter than %d bytes, true otherwise' % length)
+    out.append(' */')
+    out.append('inline bool unpack(const CanFrame& frame, %s& message)' % struct)
+    out.append('{')
+    out.append('    if (frame.id != %s::ID || frame.len < %d)' % (struct, length))
+    out.append('    {')
+    out.append('        return false;')
+    out.append('    }')
+    if word:
+        out.append('    uint64_t word;')
+        out.append('    memcpy(&word, frame.buf, sizeof(word));')
+    for signal in message.signals:
+        if signal.ctype == 'bool':
+            out.append('    message.%s = %s & 1u;' % (signal.name, shifted('word', '>>', signal.start)) if word else
+                       '    message.%s = frame.buf[%d] & 1u;' % (signal.name, signal.start // 8))
+        elif word and signal.signed:
+            out.append('    message.%s = static_cast<%s>(static_cast<int64_t>(word << %d) >> %d);' % (
+                signal.name, signal.ctype, 64 - signal.start - signal.length, 64 - signal.length))
+        elif word:
+            out.append('    message.%s = static_cast<%s>(%s & 0x%XULL);' % (
+                signal.name, signal.ctype, shifted('word', '>>', signal.start), (1 << signal.length) - 1))
+        else:
+            out.append('    memcpy(&message.%s, &frame.buf[%d], sizeof(message.%s));' % (
+                signal.name, signal.start // 8, signal.name))
+    out.append('    return true;')
+    out.append('}')
+    out.append('')
+
+    # pack
+    out.append('/** <b>Pack the signals of %s into a frame.</b> */' % message.enum_name)
+    out.append('inline void pack(const %s& message, CanFrame& frame)' % struct)
+    out.append('{')
+    out.append('    frame.id = %s::ID;' % struct)
+    out.append('    frame.len = %s::DLC;' % struct)
+    out.append('    frame.extended = false;')
+    if word:
+        terms = []
+        for signal in message.signals:
+            mask = (1 << signal.length) - 1
+            value = 'message.%s' % signal.name if not signal.signed else \
+                'static_cast<%s>(message.%s)' % (signal.ctype.replace('int', 'uint', 1), signal.name)
+            terms.append(shifted('(static_cast<uint64_t>(%s) & 0x%XULL)' % (value, mask), '<<', signal.start))
+        out.append('    const uint64_t word =')
+        for index, term in enumerate(terms):
+            out.append('        %s%s%s' % ('' if index == 0 else '| ', term, ';' if index == len(terms) - 1 else ''))
+        out.append('    memcpy(frame.buf, &word, sizeof(word));')
+    else:
+        out.append('    memset(frame.buf, 0, sizeof(frame.buf));')
+        for signal in message.signals:
+            out.append('    memcpy(&frame.buf[%d], &message.%s, sizeof(message.%s));' % (
+                signal.start // 8, signal.name, signal.name))
+    out.append('}')
+    return '\n'.join(out)
+
+
+def generate_codecs(messages, source):
+    out = []
+    out.append('// Generated by tools/dbcgen.py from %s - do not edit, edit the DBC file and regenerate.' % source)
+    out.append('')
+    out.append('#ifndef MESSAGECODECS_H')
+    out.append('#define MESSAGECODECS_H')
+    out.append('')
+    out.append('#include <cmath>')
+    out.append('#include <cstdint>')
+    out.append('#include <cstring>')
+    out.append('')
+    out.append('#include "CanFrame.h"')
+    out.append('#include "Reserved.h"')
+    out.append('')
+    out.append('/*')
+    out.append(' * Every message with signals gets a struct of raw signal values and a pack()/unpack() overload. Byte-aligned')
+    out.append(' * signals are a single memcpy at a constant offset; other signals are shifted and masked out of one 64-bit')
+    out.append(' * load with constant shifts. Scaled signals also get get<Signal>()/set<Signal>() in physical units.')
+    out.append(' * Payloads are little-endian, like BufferPacker.')
+    out.append(' */')
+    for message in messages:
+        if message.signals:
+            out.append('')
+            out.append(generate_message(message))
+    out.append('')
+    out.append('#endif //MESSAGECODECS_H')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: %s <dbc file> <include directory>' % sys.argv[0])
+    source, directory = sys.argv[1], Path(sys.argv[2])
+    messages = parse(source)
+    name = Path(source).as_posix()
+    (directory / 'ReservedIds.h').write_text(generate_ids(messages, name))
+    (directory / 'MessageCodecs.h').write_text(generate_codecs(messages, name))
+    print('%d messages, %d signals' % (len(messages), sum(len(message.signals) for message in messages)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,167 @@
+/*
+ * Host stand-in for the USB telemetry link: pushes frames through a pseudo-terminal, once with a write per frame and
+ * once through TelemetryBatcher, and reports frames per second and frame latency for both.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=gnu++17 -O2 -pthread -Iinclude tools/telemetry_bench.cpp -o telemetry_bench
+ *   ./telemetry_bench [frames] [frames per second, 0 for as fast as possible]
+ *
+ * Latency is measured from the frame's timestamp, taken just before it is handed to the batcher, to the moment the
+ * receiver has decoded it.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Cobs.h"
+#include "Reserved.h"
+#include "TelemetryBatcher.h"
+
+/** @return microseconds on the steady clock, wrapping like micros() */
+static uint32_t nowUs()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+}
+
+/** Sink that writes every byte to a file descriptor. */
+struct FdSink
+{
+    int fd;
+    uint64_t writes = 0;
+
+    size_t write(const uint8_t* data, const size_t size)
+    {
+        size_t done = 0;
+        while (done < size)
+        {
+            const ssize_t written = ::write(fd, data + done, size - done);
+            if (written <= 0)
+            {
+                return done;
+            }
+            done += static_cast<size_t>(written);
+        }
+        writes++;
+        return done;
+    }
+};
+
+struct Result
+{
+    double framesPerSecond = 0;
+    double meanLatencyUs = 0;
+    uint32_t maxLatencyUs = 0;
+    uint64_t writes = 0;
+    uint32_t received = 0;
+    uint32_t lost = 0;
+};
+
+/** Send frames through a fresh pty pair, either flushing after every frame or batching up to BATCH_SIZE bytes. */
+template <size_t BATCH_SIZE> static Result run(const uint32_t frames, const uint32_t rate, const bool perFrame)
+{
+    const int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        perror("posix_openpt");
+        exit(1);
+    }
+    const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    termios raw{};
+    tcgetattr(slave, &raw);
+    cfmakeraw(&raw);
+    tcsetattr(slave, TCSANOW, &raw);
+    tcgetattr(master, &raw);
+    cfmakeraw(&raw);
+    tcsetattr(master, TCSANOW, &raw);
+
+    Result result;
+    uint64_t totalLatency = 0;
+    std::thread receiver([&] {
+        CobsDecoder<8, 512> decoder;
+        TelemetryBatchReader reader;
+        uint8_t rx[4096];
+        pollfd readable{slave, POLLIN, 0};
+        // Stop once every frame arrived, or the link has been quiet for a second
+        while (reader.getFrameCount() < frames && poll(&readable, 1, 1000) > 0)
+        {
+            const ssize_t size = read(slave, rx, sizeof(rx));
+            if (size <= 0)
+            {
+                break;
+            }
+            // Feed in slices no longer than the decoder's ring can hold when full of the shortest batches
+            for (ssize_t offset = 0; offset < size; offset += 128)
+            {
+                const size_t slice = size - offset < 128 ? static_cast<size_t>(size - offset) : 128;
+                decoder.feed(rx + offset, slice);
+                decoder.getPackets().drain([&](const CobsPacket<512>& packet) {
+                    reader.read(packet.data, packet.size, [&](const CanFrame& frame) {
+                        const uint32_t latency = nowUs() - frame.timestamp;
+                        totalLatency += latency;
+                        result.maxLatencyUs = latency > result.maxLatencyUs ? latency : result.maxLatencyUs;
+                    });
+                });
+            }
+        }
+        result.received = reader.getFrameCount();
+        result.lost = reader.getLostCount();
+    });
+
+    FdSink sink{master};
+    TelemetryBatcher<FdSink, BATCH_SIZE> batcher(sink, 2000);
+    const auto start = std::chrono::steady_clock::now();
+    CanFrame frame;
+    frame.id = CurrentInfoId;
+    frame.len = 8;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        if (rate != 0)
+        {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(static_cast<uint64_t>(i) * 1000000 / rate));
+        }
+        memcpy(frame.buf, &i, sizeof(i));
+        frame.timestamp = nowUs();
+        batcher.append(frame, frame.timestamp);
+        if (perFrame)
+        {
+            batcher.flush(nowUs());
+        }
+        batcher.poll(nowUs());
+    }
+    batcher.flush(nowUs());
+    receiver.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    close(slave);
+    close(master);
+    result.framesPerSecond = result.received / seconds;
+    result.meanLatencyUs = result.received > 0 ? static_cast<double>(totalLatency) / result.received : 0;
+    result.writes = sink.writes;
+    return result;
+}
+
+static void print(const char* name, const Result& result)
+{
+    printf("%-16s %10.0f frames/s %10.1f us mean %8u us max latency %8llu writes %6u lost batches\n", name,
+        result.framesPerSecond, result.meanLatencyUs, result.maxLatencyUs,
+        static_cast<unsigned long long>(result.writes), result.lost);
+}
+
+int main(const int argc, char** argv)
+{
+    const uint32_t frames = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 200000;
+    const uint32_t rate = argc > 2 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 0;
+
+    print("write per frame", run<512>(frames, rate, true));
+    print("batched 64", run<64>(frames, rate, false));
+    print("batched 512", run<512>(frames, rate, false));
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * Host tool that transcodes a recorded frame log into one column file per signal.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=gnu++17 -O2 -Iinclude tools/transcode.cpp -o transcode
+ *   ./transcode session.hflg out/
+ *
+ * Every column file is then mapped read-only to print a per-signal summary, which is also how plotting and analysis
+ * scripts are expected to consume them (e.g. numpy.memmap at the offsets in the header).
+ */
+
+#include <cstdio>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ColumnFile.h"
+#include "FileStorage.h"
+#include "FrameLog.h"
+#include "MuxCodec.h"
+#include "Reserved.h"
+
+/** Largest chunk size this tool can read. */
+constexpr size_t MAX_CHUNK_SIZE = 65536;
+
+using LogReader = FrameLogReader<FileStorage, MAX_CHUNK_SIZE>;
+
+/** Transcode a single signal into directory/name.hcol. */
+template <typename T, typename EXTRACT>
+static bool writeSignal(LogReader& log, const std::string& directory, const char* name, const uint32_t id, EXTRACT extract)
+{
+    const std::string path = directory + "/" + name + ".hcol";
+    FileStorage storage(path.c_str(), true);
+    if (!storage)
+    {
+        fprintf(stderr, "cannot create %s\n", path.c_str());
+        return false;
+    }
+    const uint64_t count = transcodeColumn<T>(log, storage, name, id, extract);
+    // A failed write also makes transcodeColumn() return 0, so the storage state is what tells failure from no samples
+    if (!storage.flush())
+    {
+        fprintf(stderr, "cannot write %s\n", path.c_str());
+        return false;
+    }
+    printf("%-24s %10llu samples, %u of %u chunks read\n", name, static_cast<unsigned long long>(count),
+        static_cast<unsigned>(log.getChunksRead()), static_cast<unsigned>(log.getChunkCount()));
+    return true;
+}
+
+/** Accumulate min, max and mean over a column of any numeric type. */
+template <typename T> static void summarize(const ColumnView& column)
+{
+    const T* values = column.values<T>();
+    const uint64_t count = column.getCount();
+    if (values == nullptr || count == 0)
+    {
+        return;
+    }
+    double sum = 0;
+    T min = values[0];
+    T max = values[0];
+    for (uint64_t i = 0; i < count; i++)
+    {
+        sum += values[i];
+        min = values[i] < min ? values[i] : min;
+        max = values[i] > max ? values[i] : max;
+    }
+    const double seconds = (column.timestamps()[count - 1] - column.timestamps()[0]) / 1e6;
+    printf("%-24s min %12.3f  max %12.3f  mean %12.3f  over %.3f s\n", column.getName(), static_cast<double>(min),
+        static_cast<double>(max), sum / count, seconds);
+}
+
+/** Map a column file read-only and print its summary. */
+static void summarizeFile(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    struct stat info = {};
+    if (fd < 0 || fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return;
+    }
+    void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return;
+    }
+    const ColumnView column(static_cast<const uint8_t*>(mapped), static_cast<size_t>(info.st_size));
+    switch (column.getType())
+    {
+        case ColumnType::U8: summarize<uint8_t>(column); break;
+        case ColumnType::I8: summarize<int8_t>(column); break;
+        case ColumnType::U16: summarize<uint16_t>(column); break;
+        case ColumnType::I16: summarize<int16_t>(column); break;
+        case ColumnType::U32: summarize<uint32_t>(column); break;
+        case ColumnType::I32: summarize<int32_t>(column); break;
+        case ColumnType::F32: summarize<float>(column); break;
+        default: break;
+    }
+    munmap(mapped, static_cast<size_t>(info.st_size));
+}
+
+int main(const int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <frame log> <output directory>\n", argv[0]);
+        return 2;
+    }
+    FileStorage input(argv[1], false);
+    LogReader log(input);
+    if (!input || !log.open())
+    {
+        fprintf(stderr, "%s is not a frame log\n", argv[1]);
+        return 1;
+    }
+    const std::string directory = argv[2];
+
+    static const char* const TIRE_NAMES[] = {"front_left", "front_right", "rear_left", "rear_right"};
+    static const char* const RVC_NAMES[] = {"x_accel", "y_accel", "z_accel", "roll", "pitch", "yaw"};
+
+    bool ok = writeSignal<uint16_t>(log, directory, "throttle1", Throttle1PositionId, ColumnField<uint16_t>{0});
+    ok &= writeSignal<uint16_t>(log, directory, "throttle2", Throttle2PositionId, ColumnField<uint16_t>{0});
+    ok &= writeSignal<uint16_t>(log, directory, "brake_pressure", BrakePressureId, ColumnField<uint16_t>{0});
+    ok &= writeSignal<int16_t>(log, directory, "steering_angle", SteeringWheelAngleId, ColumnField<int16_t>{0});
+    for (uint8_t sub = 0; sub < TIRE_SUB_COUNT; sub++)
+    {
+        const std::string rpm = std::string("tire_rpm_") + TIRE_NAMES[sub];
+        const std::string temperature = std::string("tire_temp_") + TIRE_NAMES[sub];
+        ok &= writeSignal<uint16_t>(log, directory, rpm.c_str(), TireRPMId,
+            ColumnMuxField<TireRpmCodec, TireSubIDs>{static_cast<TireSubIDs>(sub)});
+        ok &= writeSignal<int16_t>(log, directory, temperature.c_str(), TireTemperatureId,
+            ColumnMuxField<TireTemperatureCodec, TireSubIDs>{static_cast<TireSubIDs>(sub)});
+    }
+    for (uint8_t sub = 0; sub < RVC_SUB_COUNT; sub++)
+    {
+        const std::string name = std::string("rvc_") + RVC_NAMES[sub];
+        ok &= writeSignal<float>(log, directory, name.c_str(), RVCId, ColumnMuxField<RvcCodec, RVCSubIDs>{static_cast<RVCSubIDs>(sub)});
+    }
+    if (!ok)
+    {
+        return 1;
+    }
+
+    printf("\n");
+    for (const char* name : {"throttle1", "throttle2", "brake_pressure", "steering_angle"})
+    {
+        summarizeFile(directory + "/" + name + ".hcol");
+    }
+    for (const char* tire : TIRE_NAMES)
+    {
+        summarizeFile(directory + "/tire_rpm_" + tire + ".hcol");
+        summarizeFile(directory + "/tire_temp_" + tire + ".hcol");
+    }
+    for (const char* rvc : RVC_NAMES)
+    {
+        summarizeFile(directory + "/rvc_" + rvc + ".hcol");
+    }
+    return 0;
+}